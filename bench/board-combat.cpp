@@ -0,0 +1,78 @@
+// Benchmark: resolve combates completos no Board (sem janela nem SDL) e mede combates/s.
+// Os tabuleiros saem de uma semente fixa: o resultado final e o mesmo a cada execucao.
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+#include "logic/Board.hpp"
+#include "logic/BaseCards.hpp"
+#include "logic/Random.hpp"
+
+static constexpr int MaxRounds = 50;
+
+// Fileiras aleatorias de criaturas base, com alguns status
+static void FillRandom(Board& board, const CardDatabase& database, Random& random) {
+    constexpr CardId creatures[] = { BaseCardId("Guerreiro"), BaseCardId("Escudeiro"), BaseCardId("Lobo") };
+
+    board.Clear();
+    board.SetHero(BoardSide::PLAYER, MakeHero(30));
+    board.SetHero(BoardSide::ENEMY, MakeHero(30));
+
+    for (BoardSide side : { BoardSide::PLAYER, BoardSide::ENEMY }) {
+        for (int lane = 0; lane < Board::Lanes; lane++) {
+            if (random.Below(4) == 0) continue;
+
+            CardInstance instance;
+            instance.id = creatures[random.Below(3)];
+            instance.attackModifier = (int8_t)random.Range(0, 2);
+
+            Entity creature = MakeCreature(database, instance);
+            // Lobo morto invoca outro: exercita o passe de gatilhos
+            if (instance.id == BaseCardId("Lobo")) {
+                creature.deathEffect = { EffectType::SUMMON, 1, BaseCardId("Lobo") };
+            }
+            if (random.Below(8) == 0) creature.flags |= STATUS_SHIELDED;
+            if (random.Below(8) == 0) creature.flags |= STATUS_POISONED;
+            if (random.Below(8) == 0) creature.flags |= STATUS_FROZEN;
+            board.Place(side, lane, creature);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int boardCount = (argc > 1) ? std::atoi(argv[1]) : 4096;
+    int repeats = (argc > 2) ? std::atoi(argv[2]) : 100;
+
+    CardDatabase database;
+    database.AddBaseSet();
+
+    Random random(2024);
+    std::vector<Board> initial(boardCount, Board(database));
+    for (Board& board : initial) {
+        FillRandom(board, database, random);
+    }
+
+    // Cada repeticao parte das mesmas posicoes: copiar um Board e um memcpy
+    std::vector<Board> boards = initial;
+    long long rounds = 0;
+    long long outcomes[4] = {};
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        boards = initial;
+        for (Board& board : boards) {
+            rounds += board.Resolve(MaxRounds);
+            outcomes[(int)board.GetOutcome()]++;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long long combats = (long long)boardCount * repeats;
+    std::cout << combats << " combates, " << rounds << " rodadas em " << seconds << " s" << std::endl;
+    std::cout << "Combates/s: " << combats / seconds << ", rodadas/s: " << rounds / seconds << std::endl;
+    std::cout << "Resultados: " << outcomes[(int)CombatOutcome::PLAYER_WON] << " jogador, "
+              << outcomes[(int)CombatOutcome::ENEMY_WON] << " inimigo, "
+              << outcomes[(int)CombatOutcome::DRAW] << " empate, "
+              << outcomes[(int)CombatOutcome::ONGOING] << " sem vencedor" << std::endl;
+    return 0;
+}
@@ -0,0 +1,159 @@
+// Benchmark: iteracoes/s da busca do Opponent com 1, 2, 4... threads, a partir da
+// mesma posicao de meio de jogo, e uma serie curta de partidas contra jogadas ao acaso.
+// Antes, confere o hash incremental do Battle contra o recalculado em partidas ao acaso;
+// qualquer diferenca vira codigo de saida diferente de zero.
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "logic/Opponent.hpp"
+#include "logic/TranspositionTable.hpp"
+#include "logic/BaseCards.hpp"
+
+static void BuildDeck(Player& player) {
+    constexpr std::pair<CardId, int> starter[] = {
+        { BaseCardId("Guerreiro"), 4 },
+        { BaseCardId("Escudeiro"), 3 },
+        { BaseCardId("Lobo"), 3 },
+        { BaseCardId("Bola de Fogo"), 2 },
+        { BaseCardId("Cura"), 2 },
+        { BaseCardId("Chamado da Matilha"), 2 }
+    };
+
+    for (auto [id, copies] : starter) {
+        for (int i = 0; i < copies; i++) player.GetDeck().Add(id);
+    }
+}
+
+static Battle NewBattle(const CardDatabase& database, uint64_t seed) {
+    Battle battle(database, seed);
+    BuildDeck(battle.GetPlayer(BoardSide::PLAYER));
+    BuildDeck(battle.GetPlayer(BoardSide::ENEMY));
+    battle.Start(30);
+    return battle;
+}
+
+static void PlayRandom(Battle& battle, Random& random) {
+    Battle::MoveList moves;
+    int count = battle.GetMoves(moves);
+    battle.Apply(moves[random.Below((uint32_t)count)]);
+}
+
+// Jogadas ao acaso, com Determinize no meio como a busca faz; conta os hashes que nao conferem
+static int CheckHashes(const CardDatabase& database, int games, uint64_t& checked) {
+    int mismatches = 0;
+    Random random(17);
+
+    for (int game = 0; game < games; game++) {
+        Battle battle = NewBattle(database, 1000 + game);
+        mismatches += battle.GetHash() != battle.ComputeHash();
+        checked++;
+
+        while (!battle.IsOver()) {
+            if (random.Below(8) == 0) {
+                battle.Determinize(battle.GetActive(), random);
+            } else {
+                PlayRandom(battle, random);
+            }
+            mismatches += battle.GetHash() != battle.ComputeHash();
+            checked++;
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char* argv[]) {
+    double budgetMs = (argc > 1) ? std::atof(argv[1]) : 50.0;
+    int searches = (argc > 2) ? std::atoi(argv[2]) : 20;
+    unsigned maxThreads = (argc > 3) ? (unsigned)std::atoi(argv[3]) : std::thread::hardware_concurrency();
+
+    CardDatabase database;
+    database.AddBaseSet();
+
+    uint64_t checked = 0;
+    int mismatches = CheckHashes(database, 2000, checked);
+    std::cout << "Hash incremental: " << mismatches << " diferencas em " << checked << " posicoes" << std::endl;
+
+    // Alguns turnos ao acaso para chegar a um tabuleiro com criaturas dos dois lados
+    Battle position = NewBattle(database, 11);
+    Random random(5);
+    while (position.GetTurn() < 7) {
+        PlayRandom(position, random);
+    }
+    while (position.GetActive() != BoardSide::ENEMY) {
+        PlayRandom(position, random);
+    }
+
+    std::cout << "Busca de " << budgetMs << " ms, " << searches << " jogadas por medida" << std::endl;
+
+    double base = 0.0;
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        ThreadPool pool(threads);
+        OpponentSettings settings;
+        settings.budgetMs = budgetMs;
+        settings.threads = threads;
+        Opponent opponent(pool, database, 3, settings);
+
+        uint64_t iterations = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < searches; i++) {
+            opponent.Choose(position);
+            iterations += opponent.GetLastIterations();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        double rate = iterations / seconds;
+        if (threads == 1) base = rate;
+        std::cout << threads << " threads: " << rate << " iteracoes/s (" << rate / base << "x)" << std::endl;
+
+        if (threads < maxThreads && threads * 2 > maxThreads) threads = maxThreads / 2;
+    }
+
+    // Mesma busca com a tabela de transposicao compartilhada entre as threads
+    {
+        ThreadPool pool(maxThreads);
+        TranspositionTable table;
+        OpponentSettings settings;
+        settings.budgetMs = budgetMs;
+        settings.threads = maxThreads;
+        Opponent opponent(pool, database, 3, settings, &table);
+
+        uint64_t iterations = 0, hits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < searches; i++) {
+            opponent.Choose(position);
+            iterations += opponent.GetLastIterations();
+            hits += opponent.GetLastTableHits();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << maxThreads << " threads com tabela: " << iterations / seconds << " iteracoes/s, "
+            << 100.0 * hits / std::max<uint64_t>(iterations, 1) << "% das folhas achadas na tabela" << std::endl;
+    }
+
+    // O oponente (inimigo) contra um jogador que escolhe ao acaso
+    ThreadPool pool;
+    OpponentSettings settings;
+    settings.maxIterations = 500;
+    Opponent opponent(pool, database, 9, settings);
+
+    int games = 20, wins = 0, draws = 0;
+    for (int game = 0; game < games; game++) {
+        Battle battle = NewBattle(database, 100 + game);
+        Random player(200 + game);
+
+        while (!battle.IsOver()) {
+            if (battle.GetActive() == BoardSide::ENEMY) {
+                battle.Apply(opponent.Choose(battle));
+            } else {
+                PlayRandom(battle, player);
+            }
+        }
+        wins += battle.GetOutcome() == CombatOutcome::ENEMY_WON;
+        draws += battle.GetOutcome() == CombatOutcome::DRAW;
+    }
+    std::cout << "Contra jogadas ao acaso: " << wins << " vitorias, " << draws << " empates em " << games << " partidas" << std::endl;
+    return mismatches > 0 ? 1 : 0;
+}
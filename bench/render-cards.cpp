@@ -0,0 +1,91 @@
+// Benchmark: desenha 10k cartas com o renderer de software (nao precisa de janela)
+// e compara o caminho imediato (uma chamada por primitiva) com a RenderQueue.
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <SDL2/SDL.h>
+#include "core/GameWorld.hpp"
+#include "core/EntitySystems.hpp"
+
+static double Seconds(Uint64 start) {
+    return (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+}
+
+// Como o Card::Render desenhava antes da fila: cor + preenchimento + contorno por carta
+static void RenderImmediate(EntityStore& store, const CardDatabase& database, SDL_Renderer* renderer) {
+    for (uint32_t i = 0; i < store.Size(); i++) {
+        SDL_Rect rect = InterpolatedRect(store, i, 1.0f);
+
+        if (database.Get(store.card[i].id).type == CardType::CREATURE) {
+            SDL_SetRenderDrawColor(renderer, 50, 100, 200, 255);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 150, 50, 200, 255);
+        }
+        SDL_RenderFillRect(renderer, &rect);
+
+        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+        SDL_RenderDrawRect(renderer, &rect);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int cardCount = (argc > 1) ? std::atoi(argv[1]) : 10000;
+    int frames = (argc > 2) ? std::atoi(argv[2]) : 100;
+
+    SDL_Init(SDL_INIT_TIMER);
+
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, 1280, 720, 32, SDL_PIXELFORMAT_RGBA32);
+    SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(surface);
+    if (!surface || !renderer) {
+        std::cerr << "Erro ao criar o renderer: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    // Mesma variedade de faces de antes: tipo i % 2, custo i % 10
+    CardDatabase database;
+    CardInstance instance;
+    for (int variant = 0; variant < 10; variant++) {
+        // Add copia o nome; a string so precisa durar ate la
+        std::string name = "Carta " + std::to_string(variant);
+        CardDefinition definition;
+        definition.name = name;
+        definition.type = (variant % 2) ? CardType::SPELL : CardType::CREATURE;
+        definition.manaCost = (uint8_t)variant;
+        database.Add(definition);
+    }
+
+    GameWorld world(database);
+    for (int i = 0; i < cardCount; i++) {
+        instance.id = (CardId)(i % 10);
+        world.SpawnCard(instance, (i * 37) % 1160, (i * 53) % 540);
+    }
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int f = 0; f < frames; f++) {
+        SDL_RenderClear(renderer);
+        RenderImmediate(world.GetEntities(), database, renderer);
+        SDL_RenderPresent(renderer);
+    }
+    double immediate = Seconds(start);
+
+    start = SDL_GetPerformanceCounter();
+    for (int f = 0; f < frames; f++) {
+        SDL_RenderClear(renderer);
+        world.Render(renderer, 1.0f);
+        SDL_RenderPresent(renderer);
+    }
+    double batched = Seconds(start);
+
+    std::cout << world.GetEntities().Size() << " cartas, " << frames << " quadros" << std::endl;
+    std::cout << "Imediato:   " << immediate * 1000.0 / frames << " ms/quadro, "
+              << world.GetEntities().Size() * 2 << " chamadas de desenho" << std::endl;
+    std::cout << "RenderQueue: " << batched * 1000.0 / frames << " ms/quadro, "
+              << world.GetLastDrawCalls() << " chamadas de desenho" << std::endl;
+    std::cout << "Cache de faces: " << world.GetCardFaces().GetHits() << " acertos, "
+              << world.GetCardFaces().GetMisses() << " faltas" << std::endl;
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,128 @@
+// Benchmark: custo de clonar, serializar e restaurar um RunState de meio de subida,
+// e quanto a thread principal fica presa num Autosave::Save.
+// Tambem confere que saves truncados ou com um bit trocado sao recusados e guardados
+// em '<save>.bad'; qualquer falha vira codigo de saida diferente de zero.
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include "core/Autosave.hpp"
+#include "logic/BaseCards.hpp"
+
+template <typename F>
+static double NanosecondsPer(int repeats, F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; i++) body(i);
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+int main(int argc, char* argv[]) {
+    int repeats = (argc > 1) ? std::atoi(argv[1]) : 100000;
+    std::string path = (argc > 2) ? argv[2] : "bench_run.sav";
+
+    CardDatabase database;
+    database.AddBaseSet();
+
+    // Meio de subida: alguns andares, cartas novas (uma modificada) e vida perdida
+    RunState run;
+    run.Start(42);
+    for (int floor = 0; floor < 8; floor++) {
+        run.GetTower().Advance((int)run.GetRandom().Below(run.GetTower().GetChoiceCount()));
+    }
+    CardInstance upgraded;
+    upgraded.id = BaseCardId("Lobo");
+    upgraded.attackModifier = 2;
+    run.AddCard(upgraded);
+    for (int i = 0; i < 6; i++) {
+        CardInstance card;
+        card.id = BaseCardId("Guerreiro");
+        run.AddCard(card);
+    }
+    run.SetHealth(17);
+
+    std::vector<uint8_t> bytes;
+    run.Serialize(bytes);
+    std::cout << "RunState: " << sizeof(RunState) << " bytes na memoria, " << bytes.size() << " bytes no save ("
+              << run.GetDeckSize() << " cartas, " << run.GetTower().GetPathLength() << " salas no caminho)" << std::endl;
+
+    // Vetores do tamanho certo: o laco nao mede alocacao
+    std::vector<RunState> copies(16);
+    double copy = NanosecondsPer(repeats, [&](int i) { copies[i & 15] = run; });
+
+    double serialize = NanosecondsPer(repeats, [&](int) {
+        bytes.clear();
+        run.Serialize(bytes);
+    });
+
+    RunState restored;
+    int failures = 0;
+    double deserialize = NanosecondsPer(repeats, [&](int) {
+        failures += !restored.Deserialize(bytes.data(), bytes.size(), database);
+    });
+
+    std::cout << "Snapshot (copia): " << copy << " ns" << std::endl;
+    std::cout << "Serializar: " << serialize << " ns" << std::endl;
+    std::cout << "Restaurar (refaz o mapa): " << deserialize << " ns" << std::endl;
+    std::cout << "Restaurado igual ao original: " << (failures == 0 && restored == run ? "sim" : "NAO") << std::endl;
+    failures += !(restored == run);
+
+    // Todo prefixo e toda troca de um bit precisam ser recusados
+    int accepted = 0;
+    for (size_t length = 0; length < bytes.size(); length++) {
+        accepted += restored.Deserialize(bytes.data(), length, database);
+    }
+    std::cout << "Truncados aceitos: " << accepted << " de " << bytes.size() << std::endl;
+    failures += accepted;
+
+    accepted = 0;
+    std::vector<uint8_t> flipped = bytes;
+    for (size_t bit = 0; bit < bytes.size() * 8; bit++) {
+        flipped[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+        accepted += restored.Deserialize(flipped.data(), flipped.size(), database);
+        flipped[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+    }
+    std::cout << "Bits trocados aceitos: " << accepted << " de " << bytes.size() * 8 << std::endl;
+    failures += accepted;
+
+    // Pedidos seguidos se juntam: o disco ve poucos saves, a thread principal so paga a copia
+    ThreadPool pool(1);
+    double longest = 0.0;
+    {
+        Autosave autosave(pool, path);
+        for (int i = 0; i < 1000; i++) {
+            run.SetHealth(1 + i % run.GetMaxHealth());
+            auto start = std::chrono::steady_clock::now();
+            autosave.Save(run);
+            longest = std::max(longest, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        }
+        autosave.Wait();
+
+        RunState loaded;
+        bool same = autosave.Load(database, loaded) && loaded == run;
+        std::cout << "Autosave: chamada mais longa " << longest << " us; arquivo final "
+                  << (same ? "igual ao ultimo estado" : "DIFERENTE")
+                  << ", " << autosave.GetFailures() << " falhas" << std::endl;
+        failures += !same + (int)autosave.GetFailures();
+
+        // Save corrompido no disco: Load recusa e o arquivo sai do caminho, intacto
+        flipped.clear();
+        run.Serialize(flipped);
+        flipped[flipped.size() / 2] ^= 0x10;
+        std::ofstream(path, std::ios::binary).write((const char*)flipped.data(), flipped.size());
+
+        std::string rejected = path + ".bad";
+        bool refused = !autosave.Load(database, loaded) && !std::ifstream(path);
+        std::ifstream kept(rejected, std::ios::binary);
+        std::vector<uint8_t> keptBytes((std::istreambuf_iterator<char>(kept)), std::istreambuf_iterator<char>());
+        bool preserved = refused && keptBytes == flipped;
+        std::cout << "Save corrompido: " << (preserved ? "recusado e guardado em " + rejected : std::string("NAO preservado")) << std::endl;
+        failures += !preserved;
+        std::remove(rejected.c_str());
+    }
+    return failures;
+}
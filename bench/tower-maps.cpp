@@ -0,0 +1,100 @@
+// Benchmark: gera N mapas da torre (sementes 0..N-1), grava o cache, le tudo de volta
+// e confere o resultado. Imprime mapas/s de cada etapa e um resumo de balanceamento.
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <algorithm>
+#include "logic/Tower.hpp"
+#include "logic/TowerCache.hpp"
+
+// Somas de um lote de mapas; geracao e leitura do cache precisam dar o mesmo
+struct Totals {
+    long long rooms = 0;
+    long long edges = 0;
+    long long paths = 0;
+    long long maxElites = 0;
+    int leastElites = 255;      // caminho com menos elites entre todos os mapas
+    int mostElites = 0;
+    int leastRests = 255;
+    int unreachable = 0;        // mapas com sala fora de qualquer caminho
+
+    void Add(const Tower& tower) {
+        TowerPathStats summary = tower.GetSummary();
+        rooms += tower.GetRoomCount();
+        edges += tower.GetEdgeCount();
+        paths += summary.paths;
+        maxElites += summary.maxElites;
+        leastElites = std::min<int>(leastElites, summary.minElites);
+        mostElites = std::max<int>(mostElites, summary.maxElites);
+        leastRests = std::min<int>(leastRests, summary.minRests);
+
+        bool reached[Tower::MaxRooms] = {};
+        for (int room = tower.GetFloorBegin(0); room < tower.GetFloorEnd(0); room++) reached[room] = true;
+        for (int room = 0; room < tower.GetRoomCount(); room++) {
+            for (int i = 0; i < tower.GetChildCount(room); i++) reached[tower.GetChildren(room)[i]] |= reached[room];
+        }
+        unreachable += !std::all_of(reached, reached + tower.GetRoomCount(), [](bool r) { return r; });
+    }
+
+    bool operator==(const Totals& other) const = default;
+};
+
+static double Since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int count = (argc > 1) ? std::atoi(argv[1]) : 100000;
+    std::string path = (argc > 2) ? argv[2] : "bench_towers.bin";
+
+    TowerSettings settings;
+    TowerCacheWriter writer(settings);
+    Tower tower;
+
+    Totals generated;
+    auto start = std::chrono::steady_clock::now();
+    for (int seed = 0; seed < count; seed++) {
+        tower.Generate(seed, settings);
+        generated.Add(tower);
+        writer.Add(tower);
+    }
+    double generateSeconds = Since(start);
+
+    start = std::chrono::steady_clock::now();
+    if (!writer.Write(path)) return 1;
+    double writeSeconds = Since(start);
+
+    TowerCacheFile cache;
+    Totals loaded;
+    start = std::chrono::steady_clock::now();
+    if (!cache.Open(path)) return 1;
+    int failed = 0;
+    for (uint32_t i = 0; i < cache.GetCount(); i++) {
+        failed += !cache.Get(i, tower);
+        loaded.Add(tower);
+    }
+    double loadSeconds = Since(start);
+
+    // Amostra: o mapa do cache e igual ao gerado de novo
+    Tower fresh;
+    int mismatches = 0;
+    for (int seed = 0; seed < count; seed += 101) {
+        fresh.Generate(seed, settings);
+        mismatches += !cache.Find(seed, tower) || !(tower == fresh);
+    }
+
+    std::cout << count << " mapas " << (int)settings.floors << "x" << (int)settings.width << std::endl;
+    std::cout << "Geracao: " << count / generateSeconds << " mapas/s (" << generateSeconds << " s)" << std::endl;
+    std::cout << "Escrita do cache: " << writeSeconds << " s" << std::endl;
+    std::cout << "Leitura do cache: " << count / loadSeconds << " mapas/s (" << loadSeconds << " s)" << std::endl;
+    std::cout << "Conferencia: " << failed << " falhas, " << mismatches << " diferencas, totais "
+              << (generated == loaded ? "iguais" : "DIFERENTES") << std::endl;
+    std::cout << "Por mapa: " << (double)generated.rooms / count << " salas, " << (double)generated.edges / count
+              << " ligacoes, " << (double)generated.paths / count << " caminhos, "
+              << (double)generated.maxElites / count << " elites no pior caminho" << std::endl;
+    std::cout << "Elites num caminho: " << generated.leastElites << " a " << generated.mostElites
+              << "; descansos no minimo: " << generated.leastRests
+              << "; mapas com sala inalcancavel: " << generated.unreachable << std::endl;
+    return failed || mismatches || !(generated == loaded);
+}
@@ -0,0 +1,261 @@
+#include "AssetManager.hpp"
+#include <SDL2/SDL_image.h>
+#include <fstream>
+#include <iostream>
+
+TextureAsset::~TextureAsset() {
+    if (surface) SDL_FreeSurface(surface);
+    if (texture) SDL_DestroyTexture(texture);
+}
+
+SoundAsset::~SoundAsset() {
+    if (chunk) Mix_FreeChunk(chunk);
+}
+
+AssetManager::AssetManager(ThreadPool& pool)
+    : pool(pool) {
+    pack = nullptr;
+    renderer = nullptr;
+    placeholder = nullptr;
+    pendingJobs = 0;
+}
+
+AssetManager::~AssetManager() {
+    Shutdown();
+}
+
+void AssetManager::Shutdown() {
+    WaitPending();
+
+    {
+        std::lock_guard<std::mutex> lock(completedMutex);
+        completed.clear();
+    }
+
+    if (placeholder) {
+        SDL_DestroyTexture(placeholder);
+        placeholder = nullptr;
+    }
+    renderer = nullptr;
+}
+
+void AssetManager::SetRenderer(SDL_Renderer* renderer) {
+    if (this->renderer == renderer) return;
+
+    if (placeholder) {
+        SDL_DestroyTexture(placeholder);
+        placeholder = nullptr;
+    }
+
+    this->renderer = renderer;
+    CreatePlaceholder();
+}
+
+void AssetManager::MountPack(const PackArchive* pack) {
+    this->pack = pack && pack->IsOpen() ? pack : nullptr;
+}
+
+SDL_RWops* AssetManager::OpenRW(const std::string& path) const {
+    if (pack) {
+        if (const PackEntry* entry = pack->Find(path)) {
+            return pack->OpenRW(*entry);
+        }
+    }
+    return SDL_RWFromFile(path.c_str(), "rb");
+}
+
+void AssetManager::CreatePlaceholder() {
+    if (!renderer) return;
+
+    // Xadrez 2x2 magenta/preto: facil de notar quando algo nao carregou
+    const Uint32 pixels[4] = { 0xFF00FFFF, 0x000000FF, 0x000000FF, 0xFF00FFFF };
+
+    placeholder = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, 2, 2);
+    if (placeholder) {
+        SDL_UpdateTexture(placeholder, nullptr, pixels, 2 * sizeof(Uint32));
+    }
+}
+
+void AssetManager::Submit(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        pendingJobs++;
+    }
+
+    pool.Submit([this, job = std::move(job)] {
+        job();
+
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        pendingJobs--;
+        if (pendingJobs == 0) {
+            pendingDone.notify_all();
+        }
+    });
+}
+
+void AssetManager::Complete(std::function<void()> finalize) {
+    std::lock_guard<std::mutex> lock(completedMutex);
+    completed.push_back(std::move(finalize));
+}
+
+void AssetManager::WaitPending() {
+    std::unique_lock<std::mutex> lock(pendingMutex);
+    pendingDone.wait(lock, [this] { return pendingJobs == 0; });
+}
+
+bool AssetManager::IsIdle() {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        if (pendingJobs > 0) return false;
+    }
+    std::lock_guard<std::mutex> lock(completedMutex);
+    return completed.empty();
+}
+
+template <typename T>
+std::shared_ptr<AssetSlot<T>> AssetManager::Lookup(std::unordered_map<std::string, std::weak_ptr<AssetSlot<T>>>& cache,
+                                                   const std::string& path, bool& created) {
+    auto it = cache.find(path);
+    if (it != cache.end()) {
+        if (auto slot = it->second.lock()) {
+            created = false;
+            return slot;
+        }
+    }
+
+    auto slot = std::make_shared<AssetSlot<T>>();
+    slot->path = path;
+    cache[path] = slot;
+    created = true;
+    return slot;
+}
+
+TextureHandle AssetManager::LoadTexture(const std::string& path) {
+    bool created;
+    auto slot = Lookup(textures, path, created);
+    if (!created) return TextureHandle(slot);
+
+    Submit([this, slot] {
+        SDL_Surface* surface = IMG_Load_RW(OpenRW(slot->path), 1);
+        if (!surface) {
+            std::cerr << "Erro ao carregar imagem " << slot->path << ": " << IMG_GetError() << std::endl;
+            slot->state.store(AssetState::FAILED, std::memory_order_release);
+            return;
+        }
+
+        slot->data.surface = surface;
+
+        // O envio para a GPU precisa acontecer na thread do renderer
+        Complete([this, slot] {
+            if (renderer) {
+                slot->data.texture = SDL_CreateTextureFromSurface(renderer, slot->data.surface);
+            }
+            SDL_FreeSurface(slot->data.surface);
+            slot->data.surface = nullptr;
+
+            slot->state.store(slot->data.texture ? AssetState::READY : AssetState::FAILED, std::memory_order_release);
+        });
+    });
+
+    return TextureHandle(slot);
+}
+
+SoundHandle AssetManager::LoadSound(const std::string& path) {
+    bool created;
+    auto slot = Lookup(sounds, path, created);
+    if (!created) return SoundHandle(slot);
+
+    Submit([this, slot] {
+        slot->data.chunk = Mix_LoadWAV_RW(OpenRW(slot->path), 1);
+        if (!slot->data.chunk) {
+            std::cerr << "Erro ao carregar audio " << slot->path << ": " << Mix_GetError() << std::endl;
+        }
+        slot->state.store(slot->data.chunk ? AssetState::READY : AssetState::FAILED, std::memory_order_release);
+    });
+
+    return SoundHandle(slot);
+}
+
+FontDataHandle AssetManager::LoadFontData(const std::string& path) {
+    bool created;
+    auto slot = Lookup(fonts, path, created);
+    if (!created) return FontDataHandle(slot);
+
+    Submit([this, slot] {
+        if (pack) {
+            if (const PackEntry* entry = pack->Find(slot->path)) {
+                auto bytes = std::make_shared<std::vector<uint8_t>>();
+                bool ok = pack->Read(*entry, *bytes);
+                slot->data.bytes = std::move(bytes);
+                slot->state.store(ok ? AssetState::READY : AssetState::FAILED, std::memory_order_release);
+                return;
+            }
+        }
+
+        std::ifstream file(slot->path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            std::cerr << "Erro ao abrir fonte " << slot->path << std::endl;
+            slot->state.store(AssetState::FAILED, std::memory_order_release);
+            return;
+        }
+
+        auto bytes = std::make_shared<std::vector<uint8_t>>((size_t)file.tellg());
+        file.seekg(0);
+        file.read((char*)bytes->data(), bytes->size());
+
+        slot->data.bytes = std::move(bytes);
+        slot->state.store(file ? AssetState::READY : AssetState::FAILED, std::memory_order_release);
+    });
+
+    return FontDataHandle(slot);
+}
+
+AtlasHandle AssetManager::LoadAtlas(const std::string& directory) {
+    auto slot = std::make_shared<AssetSlot<AtlasAsset>>();
+    slot->path = directory;
+
+    Submit([this, slot] {
+        if (!pack || slot->data.builder.AddPack(*pack, slot->path) == 0) {
+            slot->data.builder.AddDirectory(slot->path);
+        }
+        if (!slot->data.builder.Pack()) {
+            slot->state.store(AssetState::FAILED, std::memory_order_release);
+            return;
+        }
+
+        Complete([this, slot] {
+            bool ok = renderer && slot->data.builder.Upload(renderer, slot->data.atlas);
+            slot->state.store(ok ? AssetState::READY : AssetState::FAILED, std::memory_order_release);
+        });
+    });
+
+    return AtlasHandle(slot);
+}
+
+SDL_Texture* AssetManager::GetTexture(const TextureHandle& handle) const {
+    TextureAsset* asset = handle.Get();
+    return asset ? asset->texture : placeholder;
+}
+
+int AssetManager::Update(double budgetMs) {
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const Uint64 budget = (Uint64)(budgetMs * SDL_GetPerformanceFrequency() / 1000.0);
+    int processed = 0;
+
+    while (true) {
+        std::function<void()> finalize;
+        {
+            std::lock_guard<std::mutex> lock(completedMutex);
+            if (completed.empty()) break;
+            finalize = std::move(completed.front());
+            completed.pop_front();
+        }
+
+        finalize();
+        processed++;
+
+        if (SDL_GetPerformanceCounter() - start >= budget) break;
+    }
+
+    return processed;
+}
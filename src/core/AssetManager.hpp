@@ -0,0 +1,141 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <unordered_map>
+#include <cstdint>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include "ThreadPool.hpp"
+#include "TextureAtlas.hpp"
+#include "PackArchive.hpp"
+
+enum class AssetState : uint8_t {
+    LOADING,
+    READY,
+    FAILED
+};
+
+template <typename T>
+struct AssetSlot {
+    std::string path;
+    std::atomic<AssetState> state = AssetState::LOADING;
+    T data;
+};
+
+/*
+    Referencia contada para um asset. O asset e liberado quando o ultimo handle
+    (e o cache do AssetManager, que guarda apenas weak_ptr) deixa de existir.
+*/
+template <typename T>
+class AssetHandle {
+    private:
+        std::shared_ptr<AssetSlot<T>> slot;
+    public:
+        AssetHandle() {}
+        explicit AssetHandle(std::shared_ptr<AssetSlot<T>> slot) : slot(std::move(slot)) {}
+
+        bool IsValid() const { return slot != nullptr; }
+        bool IsReady() const { return slot && slot->state.load(std::memory_order_acquire) == AssetState::READY; }
+        bool IsFailed() const { return slot && slot->state.load(std::memory_order_acquire) == AssetState::FAILED; }
+        // nullptr enquanto o asset nao estiver pronto
+        T* Get() const { return IsReady() ? &slot->data : nullptr; }
+        const std::string& GetPath() const { return slot->path; }
+        void Reset() { slot.reset(); }
+};
+
+struct TextureAsset {
+    SDL_Surface* surface = nullptr;     // decodificada na thread de trabalho, liberada apos o envio
+    SDL_Texture* texture = nullptr;
+
+    ~TextureAsset();
+};
+
+struct SoundAsset {
+    Mix_Chunk* chunk = nullptr;
+
+    ~SoundAsset();
+};
+
+struct FontDataAsset {
+    std::shared_ptr<const std::vector<uint8_t>> bytes;
+};
+
+struct AtlasAsset {
+    TextureAtlasBuilder builder;
+    TextureAtlas atlas;
+};
+
+using TextureHandle = AssetHandle<TextureAsset>;
+using SoundHandle = AssetHandle<SoundAsset>;
+using FontDataHandle = AssetHandle<FontDataAsset>;
+using AtlasHandle = AssetHandle<AtlasAsset>;
+
+/*
+    Carrega assets em threads de trabalho: PNGs sao decodificados em SDL_Surface,
+    audios em Mix_Chunk e fontes lidas para a memoria. O que precisa do renderer
+    (criar texturas) fica numa fila processada por Update(), na thread principal,
+    com orcamento de tempo por quadro. Ate ficar pronta, uma textura e desenhada
+    com uma textura substituta.
+*/
+class AssetManager {
+    private:
+        ThreadPool& pool;
+        const PackArchive* pack;
+        SDL_Renderer* renderer;
+        SDL_Texture* placeholder;
+
+        std::mutex completedMutex;
+        std::deque<std::function<void()>> completed;   // etapas finais, rodam na thread principal
+
+        std::mutex pendingMutex;
+        std::condition_variable pendingDone;
+        int pendingJobs;
+
+        std::unordered_map<std::string, std::weak_ptr<AssetSlot<TextureAsset>>> textures;
+        std::unordered_map<std::string, std::weak_ptr<AssetSlot<SoundAsset>>> sounds;
+        std::unordered_map<std::string, std::weak_ptr<AssetSlot<FontDataAsset>>> fonts;
+
+        void Submit(std::function<void()> job);
+        void Complete(std::function<void()> finalize);
+        void CreatePlaceholder();
+        // Fluxo do pacote montado, se ele tiver o caminho; senao do disco
+        SDL_RWops* OpenRW(const std::string& path) const;
+
+        template <typename T>
+        static std::shared_ptr<AssetSlot<T>> Lookup(std::unordered_map<std::string, std::weak_ptr<AssetSlot<T>>>& cache,
+                                                    const std::string& path, bool& created);
+    public:
+        AssetManager(ThreadPool& pool);
+        ~AssetManager();
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        // Texturas pertencem ao renderer; defina antes de pedir texturas
+        void SetRenderer(SDL_Renderer* renderer);
+        // Caminhos presentes no pacote passam a ser lidos dele; o pacote deve viver mais que o AssetManager
+        void MountPack(const PackArchive* pack);
+
+        TextureHandle LoadTexture(const std::string& path);
+        SoundHandle LoadSound(const std::string& path);
+        FontDataHandle LoadFontData(const std::string& path);
+        // Decodifica e empacota todas as imagens .png do diretorio em um atlas
+        AtlasHandle LoadAtlas(const std::string& directory);
+
+        // Textura pronta ou a substituta enquanto carrega
+        SDL_Texture* GetTexture(const TextureHandle& handle) const;
+
+        // Roda etapas finais ate estourar o orcamento (pelo menos uma); retorna quantas rodaram
+        int Update(double budgetMs);
+        bool IsIdle();
+        // Espera todas as tarefas das threads de trabalho
+        void WaitPending();
+        // Espera as tarefas e libera o que depende do renderer; chamar antes de destruir o renderer
+        void Shutdown();
+};
@@ -0,0 +1,79 @@
+#include "Autosave.hpp"
+#include "MappedFile.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+Autosave::Autosave(ThreadPool& pool, std::string path) : pool(pool), path(std::move(path)) {
+    hasPending = false;
+    writing = false;
+    failures = 0;
+}
+
+Autosave::~Autosave() {
+    Wait();
+}
+
+void Autosave::Save(const RunState& state) {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending = state;
+    hasPending = true;
+
+    // Uma tarefa por vez; a que esta rodando pega o estado novo quando terminar
+    if (!writing) {
+        writing = true;
+        pool.Submit([this] { WriteLoop(); });
+    }
+}
+
+void Autosave::WriteLoop() {
+    std::vector<uint8_t> bytes;
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (hasPending) {
+        RunState snapshot = pending;
+        hasPending = false;
+
+        lock.unlock();
+        bytes.clear();
+        snapshot.Serialize(bytes);
+        bool ok = WriteFileAtomic(path, bytes);
+        lock.lock();
+
+        if (!ok) failures++;
+    }
+
+    writing = false;
+    done.notify_all();
+}
+
+void Autosave::Wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return !writing; });
+}
+
+uint64_t Autosave::GetFailures() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return failures;
+}
+
+bool Autosave::Load(const CardDatabase& database, RunState& out) const {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    if (!out.Deserialize(bytes.data(), bytes.size(), database)) {
+        // Pode ser so o cards.bin que faltou: o save fica guardado para voltar depois
+        std::string rejected = path + ".bad";
+        if (std::rename(path.c_str(), rejected.c_str()) == 0) {
+            std::cerr << "Save invalido ou de outra versao, guardado em " << rejected << std::endl;
+        } else {
+            std::cerr << "Save invalido ou de outra versao: " << path << std::endl;
+        }
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include "ThreadPool.hpp"
+#include "../logic/RunState.hpp"
+
+/*
+    Salva o RunState sem travar o quadro: Save() so copia o estado e agenda a
+    escrita no ThreadPool. A tarefa serializa, grava num temporario, faz fsync e
+    renomeia por cima do save anterior; uma queda no meio deixa o save antigo
+    inteiro. Pedidos feitos durante uma escrita se juntam: so o mais recente e
+    gravado quando ela termina.
+*/
+class Autosave {
+    private:
+        ThreadPool& pool;
+        std::string path;
+
+        std::mutex mutex;
+        std::condition_variable done;
+        RunState pending;
+        bool hasPending;
+        bool writing;
+        uint64_t failures;
+
+        void WriteLoop();
+    public:
+        Autosave(ThreadPool& pool, std::string path);
+        // Espera a escrita em andamento: o ultimo estado pedido chega ao disco
+        ~Autosave();
+
+        Autosave(const Autosave&) = delete;
+        Autosave& operator=(const Autosave&) = delete;
+
+        void Save(const RunState& state);
+        // Bloqueia ate nao haver escrita pendente
+        void Wait();
+        uint64_t GetFailures();
+
+        /*
+            Leitura sincrona, para a inicializacao; false se nao ha save ou ele nao confere.
+            Um save recusado (corrompido, de outra versao, ou com cartas que este
+            banco nao tem) e renomeado para '<path>.bad' em vez de ser sobrescrito
+            pela proxima gravacao.
+        */
+        bool Load(const CardDatabase& database, RunState& out) const;
+        const std::string& GetPath() const { return path; }
+};
@@ -0,0 +1,194 @@
+#include "CardFaceCache.hpp"
+
+CardFaceCache::CardFaceCache(int faceWidth, int faceHeight, size_t budgetBytes)
+    : faceWidth(faceWidth), faceHeight(faceHeight), budgetBytes(budgetBytes) {
+    slotsPerRow = PageSize / faceWidth;
+    slotsPerPage = slotsPerRow * (PageSize / faceHeight);
+    renderer = nullptr;
+    font = nullptr;
+    lruHead = NoSlot;
+    lruTail = NoSlot;
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
+
+CardFaceCache::~CardFaceCache() {
+    Release();
+}
+
+void CardFaceCache::Release() {
+    for (auto page : pages) {
+        SDL_DestroyTexture(page);
+    }
+    pages.clear();
+    lookup.clear();
+    slotKey.clear();
+    lruPrev.clear();
+    lruNext.clear();
+    freeSlots.clear();
+    lruHead = NoSlot;
+    lruTail = NoSlot;
+}
+
+void CardFaceCache::SetRenderer(SDL_Renderer* renderer) {
+    if (this->renderer == renderer) return;
+
+    Release();
+    this->renderer = renderer;
+}
+
+void CardFaceCache::SetFont(FontCache* font) {
+    if (this->font == font) return;
+
+    this->font = font;
+    InvalidateAll();
+}
+
+int CardFaceCache::MaxPages() const {
+    size_t pageBytes = (size_t)PageSize * PageSize * 4;
+    size_t maxPages = budgetBytes / pageBytes;
+    return maxPages > 0 ? (int)maxPages : 1;
+}
+
+void CardFaceCache::SetBudget(size_t bytes) {
+    budgetBytes = bytes;
+
+    // Paginas alem do novo orcamento sao liberadas; como os slots se misturam na LRU, recomeca do zero
+    if ((int)pages.size() > MaxPages()) {
+        Release();
+    }
+}
+
+bool CardFaceCache::AddPage() {
+    if (!renderer || slotsPerPage == 0) return false;
+
+    SDL_Texture* page = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, PageSize, PageSize);
+    if (!page) return false;
+
+    SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+
+    int firstSlot = (int)pages.size() * slotsPerPage;
+    pages.push_back(page);
+
+    slotKey.resize(firstSlot + slotsPerPage, 0);
+    lruPrev.resize(firstSlot + slotsPerPage, NoSlot);
+    lruNext.resize(firstSlot + slotsPerPage, NoSlot);
+
+    // Empilha em ordem inversa para preencher a pagina a partir do primeiro slot
+    for (int slot = firstSlot + slotsPerPage - 1; slot >= firstSlot; slot--) {
+        freeSlots.push_back(slot);
+    }
+    return true;
+}
+
+SDL_Rect CardFaceCache::SlotRect(int slot) const {
+    int local = slot % slotsPerPage;
+    return {
+        (local % slotsPerRow) * faceWidth,
+        (local / slotsPerRow) * faceHeight,
+        faceWidth,
+        faceHeight
+    };
+}
+
+void CardFaceCache::Unlink(int slot) {
+    int prev = lruPrev[slot];
+    int next = lruNext[slot];
+
+    if (prev != NoSlot) lruNext[prev] = next; else lruHead = next;
+    if (next != NoSlot) lruPrev[next] = prev; else lruTail = prev;
+
+    lruPrev[slot] = NoSlot;
+    lruNext[slot] = NoSlot;
+}
+
+void CardFaceCache::PushFront(int slot) {
+    lruPrev[slot] = NoSlot;
+    lruNext[slot] = lruHead;
+    if (lruHead != NoSlot) lruPrev[lruHead] = slot;
+    lruHead = slot;
+    if (lruTail == NoSlot) lruTail = slot;
+}
+
+void CardFaceCache::Touch(int slot) {
+    if (lruHead == slot) return;
+    Unlink(slot);
+    PushFront(slot);
+}
+
+bool CardFaceCache::Get(uint64_t key, const CardVisual& visual, CachedFace& out) {
+    auto it = lookup.find(key);
+    if (it != lookup.end()) {
+        int slot = it->second;
+        Touch(slot);
+        out.texture = pages[slot / slotsPerPage];
+        out.src = SlotRect(slot);
+        hits++;
+        return true;
+    }
+
+    if (!renderer) return false;
+
+    int slot;
+    if (freeSlots.empty() && (int)pages.size() < MaxPages()) {
+        AddPage();
+    }
+
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else if (lruTail != NoSlot) {
+        // Reaproveita a regiao do slot menos usado em vez de criar outra textura
+        slot = lruTail;
+        Unlink(slot);
+        lookup.erase(slotKey[slot]);
+        evictions++;
+    } else {
+        return false;
+    }
+
+    SDL_Texture* page = pages[slot / slotsPerPage];
+    SDL_Rect rect = SlotRect(slot);
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, page);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderFillRect(renderer, &rect);
+    DrawCardFace(renderer, rect, visual, font);
+    SDL_SetRenderTarget(renderer, previousTarget);
+
+    slotKey[slot] = key;
+    lookup[key] = slot;
+    PushFront(slot);
+    misses++;
+
+    out.texture = page;
+    out.src = rect;
+    return true;
+}
+
+void CardFaceCache::Invalidate(uint64_t key) {
+    auto it = lookup.find(key);
+    if (it == lookup.end()) return;
+
+    int slot = it->second;
+    lookup.erase(it);
+    Unlink(slot);
+    freeSlots.push_back(slot);
+}
+
+void CardFaceCache::InvalidateAll(bool texturesLost) {
+    if (texturesLost) {
+        Release();
+        return;
+    }
+
+    while (lruHead != NoSlot) {
+        int slot = lruHead;
+        Unlink(slot);
+        freeSlots.push_back(slot);
+    }
+    lookup.clear();
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <SDL2/SDL.h>
+#include "../objects/CardFace.hpp"
+
+struct CachedFace {
+    SDL_Texture* texture;
+    SDL_Rect src;
+};
+
+/*
+    Cache de faces de carta ja rasterizadas.
+    As faces tem todas o mesmo tamanho e ocupam slots de paginas grandes
+    (texturas render target de PageSize x PageSize), entao cartas em cache
+    continuam sendo desenhadas em um unico lote pela RenderQueue.
+    A chave combina a definicao da carta com o estado visual; quando o
+    orcamento de memoria acaba, o slot usado ha mais tempo (LRU) e reaproveitado.
+*/
+class CardFaceCache {
+    public:
+        static constexpr size_t DefaultBudget = 32 * 1024 * 1024;
+    private:
+        static constexpr int PageSize = 2048;
+        static constexpr int NoSlot = -1;
+
+        int faceWidth, faceHeight;
+        int slotsPerRow, slotsPerPage;
+        size_t budgetBytes;
+        SDL_Renderer* renderer;
+        FontCache* font;
+
+        std::vector<SDL_Texture*> pages;
+        std::unordered_map<uint64_t, int> lookup;   // chave -> slot
+        std::vector<uint64_t> slotKey;
+        // Lista LRU intrusiva sobre os slots ocupados (head = mais recente)
+        std::vector<int> lruPrev, lruNext;
+        int lruHead, lruTail;
+        std::vector<int> freeSlots;
+
+        Uint64 hits, misses, evictions;
+
+        int MaxPages() const;
+        bool AddPage();
+        void Touch(int slot);
+        void Unlink(int slot);
+        void PushFront(int slot);
+        SDL_Rect SlotRect(int slot) const;
+        void Release();
+    public:
+        CardFaceCache(int faceWidth, int faceHeight, size_t budgetBytes = DefaultBudget);
+        ~CardFaceCache();
+
+        CardFaceCache(const CardFaceCache&) = delete;
+        CardFaceCache& operator=(const CardFaceCache&) = delete;
+
+        // Texturas pertencem ao renderer: trocar de renderer descarta o cache
+        void SetRenderer(SDL_Renderer* renderer);
+        // Memoria maxima das paginas; sempre cabe pelo menos uma
+        void SetBudget(size_t bytes);
+        size_t GetBudget() const { return budgetBytes; }
+        // Fonte dos textos da face; trocar de fonte invalida as faces ja rasterizadas
+        void SetFont(FontCache* font);
+        FontCache* GetFont() const { return font; }
+
+        // Retorna false se nao houver renderer/textura disponivel (use o desenho por primitivas)
+        bool Get(uint64_t key, const CardVisual& visual, CachedFace& out);
+
+        void Invalidate(uint64_t key);
+        /*
+            Esquece todas as faces. Apos SDL_RENDER_TARGETS_RESET o conteudo das paginas
+            se perde, mas as texturas continuam; apos SDL_RENDER_DEVICE_RESET as
+            texturas tambem (texturesLost) e as paginas sao recriadas sob demanda.
+        */
+        void InvalidateAll(bool texturesLost = false);
+
+        size_t Size() const { return lookup.size(); }
+        Uint64 GetHits() const { return hits; }
+        Uint64 GetMisses() const { return misses; }
+        Uint64 GetEvictions() const { return evictions; }
+};
+
+// Chave do cache: definicao da carta + estado visual
+inline uint64_t CardFaceKey(uint64_t definitionHash, bool hovered) {
+    return (definitionHash << 1) | (hovered ? 1u : 0u);
+}
@@ -0,0 +1,52 @@
+#include "DamageTracker.hpp"
+
+void DamageTracker::Add(const DamageTracker& other) {
+    if (other.full) {
+        AddFull();
+        return;
+    }
+    for (const SDL_Rect& rect : other.rects) {
+        Add(rect);
+    }
+}
+
+void DamageTracker::Resolve(int width, int height, std::vector<SDL_Rect>& out) const {
+    out.clear();
+    const SDL_Rect screen = { 0, 0, width, height };
+
+    if (full) {
+        out.push_back(screen);
+        return;
+    }
+
+    for (const SDL_Rect& rect : rects) {
+        SDL_Rect region;
+        if (!SDL_IntersectRect(&rect, &screen, &region)) continue;
+
+        // Absorve toda regiao que intersecta; a uniao pode passar a tocar outras
+        bool merged = true;
+        while (merged) {
+            merged = false;
+            for (size_t i = 0; i < out.size(); i++) {
+                if (!SDL_HasIntersection(&region, &out[i])) continue;
+
+                SDL_UnionRect(&region, &out[i], &region);
+                out[i] = out.back();
+                out.pop_back();
+                merged = true;
+                break;
+            }
+        }
+        out.push_back(region);
+    }
+
+    long long area = 0;
+    for (const SDL_Rect& region : out) {
+        area += (long long)region.w * region.h;
+    }
+
+    if (out.size() > MaxRegions || area > (long long)(MaxCoverage * width * height)) {
+        out.clear();
+        out.push_back(screen);
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <vector>
+#include <SDL2/SDL.h>
+
+/*
+    Retangulos da tela que mudaram desde o ultimo quadro desenhado.
+    Resolve() junta os que se tocam em regioes disjuntas: cada pixel e
+    redesenhado uma unica vez, mesmo com primitivas semitransparentes.
+*/
+class DamageTracker {
+    private:
+        // Acima disso redesenhar tudo sai mais barato que varias passadas recortadas
+        static constexpr size_t MaxRegions = 16;
+        static constexpr float MaxCoverage = 0.5f;
+        // Sem ninguem consumindo (ex.: modo normal), vira tela cheia em vez de crescer sem limite
+        static constexpr size_t MaxPending = 256;
+
+        std::vector<SDL_Rect> rects;
+        bool full;
+    public:
+        DamageTracker() : full(false) {}
+
+        void Add(const SDL_Rect& rect) {
+            if (full || rect.w <= 0 || rect.h <= 0) return;
+            if (rects.size() >= MaxPending) {
+                AddFull();
+                return;
+            }
+            rects.push_back(rect);
+        }
+        void Add(const DamageTracker& other);
+        void AddFull() { full = true; rects.clear(); }
+        void Clear() { full = false; rects.clear(); }
+
+        bool IsFull() const { return full; }
+        bool IsEmpty() const { return !full && rects.empty(); }
+
+        // Regioes a redesenhar dentro de width x height; vazio se nada mudou
+        void Resolve(int width, int height, std::vector<SDL_Rect>& out) const;
+};
@@ -0,0 +1,186 @@
+#include "EntityStore.hpp"
+#include <utility>
+#include <functional>
+
+EntityStore::EntityStore() {
+    depthCounter = 0;
+}
+
+EntityHandle EntityStore::Create() {
+    uint32_t slot;
+
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = (uint32_t)slotGeneration.size();
+        slotGeneration.push_back(0);
+        slotDense.push_back(InvalidIndex);
+        slotChanged.push_back(0);
+    }
+
+    uint32_t dense = Size();
+    slotDense[slot] = dense;
+    denseSlot.push_back(slot);
+
+    mask.push_back(0);
+    transform.x.push_back(0);
+    transform.y.push_back(0);
+    transform.prevX.push_back(0);
+    transform.prevY.push_back(0);
+    transform.width.push_back(0);
+    transform.height.push_back(0);
+    hovered.push_back(0);
+    // Entidade nova nasce por cima; 0 fica para o que nao e entidade
+    depth.push_back(++depthCounter);
+    card.emplace_back();
+
+    return { slot, slotGeneration[slot] };
+}
+
+template <typename T>
+static void SwapRemove(std::vector<T>& v, uint32_t dense) {
+    if (dense != v.size() - 1) {
+        v[dense] = std::move(v.back());
+    }
+    v.pop_back();
+}
+
+void EntityStore::Destroy(EntityHandle handle) {
+    uint32_t dense = DenseIndex(handle);
+    if (dense == InvalidIndex) return;
+
+    uint32_t lastSlot = denseSlot.back();
+
+    SwapRemove(denseSlot, dense);
+    SwapRemove(mask, dense);
+    SwapRemove(transform.x, dense);
+    SwapRemove(transform.y, dense);
+    SwapRemove(transform.prevX, dense);
+    SwapRemove(transform.prevY, dense);
+    SwapRemove(transform.width, dense);
+    SwapRemove(transform.height, dense);
+    SwapRemove(hovered, dense);
+    SwapRemove(depth, dense);
+    SwapRemove(card, dense);
+
+    if (lastSlot != handle.index) {
+        slotDense[lastSlot] = dense;
+    }
+
+    slotDense[handle.index] = InvalidIndex;
+    slotGeneration[handle.index]++;
+    // A entrada antiga em 'changed' fica invalida; o slot pode ser marcado de novo quando reutilizado
+    slotChanged[handle.index] = 0;
+    freeSlots.push_back(handle.index);
+}
+
+void EntityStore::Clear() {
+    for (uint32_t slot : denseSlot) {
+        slotDense[slot] = InvalidIndex;
+        slotGeneration[slot]++;
+        freeSlots.push_back(slot);
+    }
+
+    denseSlot.clear();
+    mask.clear();
+    transform.x.clear();
+    transform.y.clear();
+    transform.prevX.clear();
+    transform.prevY.clear();
+    transform.width.clear();
+    transform.height.clear();
+    hovered.clear();
+    depth.clear();
+    depthCounter = 0;
+    card.clear();
+    ClearChanged();
+}
+
+bool EntityStore::IsAlive(EntityHandle handle) const {
+    return DenseIndex(handle) != InvalidIndex;
+}
+
+uint32_t EntityStore::DenseIndex(EntityHandle handle) const {
+    if (handle.index >= slotGeneration.size()) return InvalidIndex;
+    if (slotGeneration[handle.index] != handle.generation) return InvalidIndex;
+    return slotDense[handle.index];
+}
+
+EntityHandle EntityStore::HandleOfSlot(uint32_t slot) const {
+    if (slot >= slotGeneration.size()) return InvalidEntity;
+    return { slot, slotGeneration[slot] };
+}
+
+EntityHandle EntityStore::HandleAt(uint32_t dense) const {
+    uint32_t slot = denseSlot[dense];
+    return { slot, slotGeneration[slot] };
+}
+
+void EntityStore::AddTransform(EntityHandle handle, int x, int y, int width, int height) {
+    uint32_t dense = DenseIndex(handle);
+    if (dense == InvalidIndex) return;
+
+    transform.x[dense] = x;
+    transform.y[dense] = y;
+    transform.prevX[dense] = x;
+    transform.prevY[dense] = y;
+    transform.width[dense] = width;
+    transform.height[dense] = height;
+    mask[dense] |= COMPONENT_TRANSFORM;
+    MarkChanged(dense);
+}
+
+void EntityStore::MarkChanged(uint32_t dense) {
+    uint32_t slot = denseSlot[dense];
+    if (slotChanged[slot]) return;
+
+    slotChanged[slot] = 1;
+    changed.push_back({ slot, slotGeneration[slot] });
+}
+
+void EntityStore::ClearChanged() {
+    for (EntityHandle handle : changed) {
+        slotChanged[handle.index] = 0;
+    }
+    changed.clear();
+}
+
+void EntityStore::SetPosition(uint32_t dense, int x, int y) {
+    if (transform.x[dense] == x && transform.y[dense] == y) return;
+
+    transform.x[dense] = x;
+    transform.y[dense] = y;
+    MarkChanged(dense);
+}
+
+void EntityStore::SetSize(uint32_t dense, int width, int height) {
+    if (transform.width[dense] == width && transform.height[dense] == height) return;
+
+    transform.width[dense] = width;
+    transform.height[dense] = height;
+    MarkChanged(dense);
+}
+
+void EntityStore::BringToFront(uint32_t dense) {
+    if (depth[dense] == depthCounter) return;
+
+    depth[dense] = ++depthCounter;
+    MarkChanged(dense);
+}
+
+void EntityStore::AddHover(EntityHandle handle) {
+    uint32_t dense = DenseIndex(handle);
+    if (dense == InvalidIndex) return;
+
+    hovered[dense] = 0;
+    mask[dense] |= COMPONENT_HOVER;
+}
+
+void EntityStore::AddCard(EntityHandle handle, const CardInstance& instance) {
+    uint32_t dense = DenseIndex(handle);
+    if (dense == InvalidIndex) return;
+
+    card[dense] = instance;
+    mask[dense] |= COMPONENT_CARD;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "../logic/CardDatabase.hpp"
+
+// Indice estavel + geracao: um handle de entidade destruida nunca aponta para a que reutilizou o slot
+struct EntityHandle {
+    uint32_t index;
+    uint32_t generation;
+
+    bool operator==(const EntityHandle& other) const = default;
+};
+
+inline constexpr EntityHandle InvalidEntity = { UINT32_MAX, 0 };
+
+enum ComponentMask : uint32_t {
+    COMPONENT_TRANSFORM = 1u << 0,
+    COMPONENT_HOVER     = 1u << 1,
+    COMPONENT_CARD      = 1u << 2
+};
+
+/*
+    Armazena os componentes das entidades em arrays contiguos (SoA).
+    Todos os arrays tem o mesmo tamanho e sao indexados pelo indice denso;
+    remover uma entidade move a ultima para o buraco, mantendo os arrays compactos.
+    Os sistemas (EntitySystems.hpp) percorrem esses arrays linearmente.
+*/
+class EntityStore {
+    private:
+        // slot do handle -> indice denso
+        std::vector<uint32_t> slotGeneration;
+        std::vector<uint32_t> slotDense;
+        std::vector<uint32_t> freeSlots;
+        // indice denso -> slot do handle
+        std::vector<uint32_t> denseSlot;
+
+        // Entidades cujo retangulo ou profundidade mudou desde o ultimo ClearChanged (sem repeticao)
+        std::vector<EntityHandle> changed;
+        std::vector<uint8_t> slotChanged;
+
+        uint32_t depthCounter;
+
+        void MarkChanged(uint32_t dense);
+
+    public:
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+        std::vector<uint32_t> mask;
+
+        struct Transforms {
+            std::vector<int> x, y;
+            std::vector<int> prevX, prevY;
+            std::vector<int> width, height;
+        } transform;
+
+        std::vector<uint8_t> hovered;
+
+        // Ordem de empilhamento (maior fica por cima): chave do desenho e do clique
+        std::vector<uint32_t> depth;
+
+        // Nome, tipo e custo ficam no CardDatabase; aqui so o id e os modificadores da copia
+        std::vector<CardInstance> card;
+
+        EntityStore();
+
+        EntityHandle Create();
+        void Destroy(EntityHandle handle);
+        void Clear();
+
+        bool IsAlive(EntityHandle handle) const;
+        // Retorna InvalidIndex se o handle nao for mais valido
+        uint32_t DenseIndex(EntityHandle handle) const;
+        EntityHandle HandleAt(uint32_t dense) const;
+        // Handle atual do slot (handle.index), vivo ou nao
+        EntityHandle HandleOfSlot(uint32_t slot) const;
+        uint32_t Size() const { return (uint32_t)denseSlot.size(); }
+
+        void AddTransform(EntityHandle handle, int x, int y, int width, int height);
+        void AddHover(EntityHandle handle);
+        // Movem a entidade e a registram em GetChanged(), para quem indexa os retangulos
+        void SetPosition(uint32_t dense, int x, int y);
+        void SetSize(uint32_t dense, int width, int height);
+        // Poe a entidade acima de todas as outras; tambem entra em GetChanged()
+        void BringToFront(uint32_t dense);
+        const std::vector<EntityHandle>& GetChanged() const { return changed; }
+        void ClearChanged();
+
+        void AddCard(EntityHandle handle, const CardInstance& instance);
+        bool Has(uint32_t dense, uint32_t components) const { return (mask[dense] & components) == components; }
+};
@@ -0,0 +1,96 @@
+#include "EntitySystems.hpp"
+
+void StorePreviousTransforms(EntityStore& store) {
+    const uint32_t count = store.Size();
+    int* x = store.transform.x.data();
+    int* y = store.transform.y.data();
+    int* prevX = store.transform.prevX.data();
+    int* prevY = store.transform.prevY.data();
+
+    for (uint32_t i = 0; i < count; i++) {
+        prevX[i] = x[i];
+        prevY[i] = y[i];
+    }
+}
+
+bool AnyTransformMoved(const EntityStore& store) {
+    const uint32_t count = store.Size();
+    const int* x = store.transform.x.data();
+    const int* y = store.transform.y.data();
+    const int* prevX = store.transform.prevX.data();
+    const int* prevY = store.transform.prevY.data();
+
+    int moved = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        moved |= (x[i] ^ prevX[i]) | (y[i] ^ prevY[i]);
+    }
+    return moved != 0;
+}
+
+void CollectMotionRects(const EntityStore& store, std::vector<SDL_Rect>& out) {
+    const uint32_t count = store.Size();
+
+    for (uint32_t i = 0; i < count; i++) {
+        int x = store.transform.x[i];
+        int y = store.transform.y[i];
+        int prevX = store.transform.prevX[i];
+        int prevY = store.transform.prevY[i];
+        if (x == prevX && y == prevY) continue;
+
+        // Qualquer posicao interpolada fica dentro da uniao das duas
+        SDL_Rect from = { prevX, prevY, store.transform.width[i], store.transform.height[i] };
+        SDL_Rect to = { x, y, store.transform.width[i], store.transform.height[i] };
+        SDL_Rect swept;
+        SDL_UnionRect(&from, &to, &swept);
+        out.push_back(swept);
+    }
+}
+
+SDL_Rect InterpolatedRect(const EntityStore& store, uint32_t dense, float alpha) {
+    int x = store.transform.x[dense];
+    int y = store.transform.y[dense];
+    int prevX = store.transform.prevX[dense];
+    int prevY = store.transform.prevY[dense];
+
+    return {
+        prevX + (int)((x - prevX) * alpha),
+        prevY + (int)((y - prevY) * alpha),
+        store.transform.width[dense],
+        store.transform.height[dense]
+    };
+}
+
+void RenderCard(const EntityStore& store, const CardDatabase& database, uint32_t dense, RenderQueue& queue, float alpha,
+                CardFaceCache* faces, int16_t layer) {
+    SDL_Rect rect = InterpolatedRect(store, dense, alpha);
+    queue.SetDepth(store.depth[dense]);
+    bool hovered = store.hovered[dense] != 0;
+
+    const CardInstance& instance = store.card[dense];
+    const CardDefinition& definition = database.Get(instance.id);
+
+    CardVisual visual = {
+        definition.name,
+        definition.type,
+        database.GetManaCost(instance),
+        hovered
+    };
+
+    CachedFace face;
+    if (faces && faces->Get(CardFaceKey(database.GetVisualHash(instance), hovered), visual, face)) {
+        queue.DrawTexture(face.texture, &face.src, rect, { 255, 255, 255, 255 }, layer);
+    } else {
+        QueueCardFace(queue, rect, visual, faces ? faces->GetFont() : nullptr, layer);
+    }
+}
+
+void RenderCards(const EntityStore& store, const CardDatabase& database, RenderQueue& queue, float alpha,
+                 CardFaceCache* faces, uint32_t skip) {
+    const uint32_t count = store.Size();
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (i != skip && store.Has(i, COMPONENT_TRANSFORM | COMPONENT_CARD)) {
+            RenderCard(store, database, i, queue, alpha, faces);
+        }
+    }
+}
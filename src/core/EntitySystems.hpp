@@ -0,0 +1,22 @@
+#pragma once
+#include <vector>
+#include <SDL2/SDL.h>
+#include "EntityStore.hpp"
+#include "RenderQueue.hpp"
+#include "CardFaceCache.hpp"
+
+// Sistemas: passagens lineares sobre os arrays do EntityStore
+
+void StorePreviousTransforms(EntityStore& store);
+// Retorna true se alguma entidade se moveu no ultimo passo
+bool AnyTransformMoved(const EntityStore& store);
+// Para cada entidade em movimento, o retangulo que cobre a posicao anterior e a atual
+void CollectMotionRects(const EntityStore& store, std::vector<SDL_Rect>& out);
+
+SDL_Rect InterpolatedRect(const EntityStore& store, uint32_t dense, float alpha);
+// faces == nullptr: desenha a carta por primitivas em vez de copiar a face do cache
+void RenderCard(const EntityStore& store, const CardDatabase& database, uint32_t dense, RenderQueue& queue, float alpha,
+                CardFaceCache* faces = nullptr, int16_t layer = LAYER_CARDS);
+// 'skip': indice denso desenhado a parte (ex.: carta sendo arrastada, por cima das outras)
+void RenderCards(const EntityStore& store, const CardDatabase& database, RenderQueue& queue, float alpha,
+                 CardFaceCache* faces = nullptr, uint32_t skip = EntityStore::InvalidIndex);
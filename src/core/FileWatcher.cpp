@@ -0,0 +1,88 @@
+#include "FileWatcher.hpp"
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/inotify.h>
+#endif
+
+FileWatcher::FileWatcher() {
+    inotifyFd = -1;
+    watchDescriptor = -1;
+}
+
+FileWatcher::~FileWatcher() {
+    Stop();
+}
+
+bool FileWatcher::Watch(const std::string& path) {
+    Stop();
+
+    std::filesystem::path file(path);
+    std::filesystem::path directory = file.parent_path().empty() ? std::filesystem::path(".") : file.parent_path();
+
+#ifdef __linux__
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        std::cerr << "Erro ao iniciar inotify: " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    watchDescriptor = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (watchDescriptor < 0) {
+        std::cerr << "Erro ao observar " << directory << ": " << strerror(errno) << std::endl;
+        Stop();
+        return false;
+    }
+#else
+    std::error_code error;
+    lastWrite = std::filesystem::last_write_time(file, error);
+#endif
+
+    this->path = path;
+    fileName = file.filename().string();
+    return true;
+}
+
+void FileWatcher::Stop() {
+#ifdef __linux__
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+    }
+#endif
+    inotifyFd = -1;
+    watchDescriptor = -1;
+    path.clear();
+    fileName.clear();
+}
+
+bool FileWatcher::Poll() {
+    if (path.empty()) return false;
+
+#ifdef __linux__
+    bool changed = false;
+    alignas(inotify_event) char buffer[4096];
+
+    while (true) {
+        ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) break;
+
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event = (const inotify_event*)(buffer + offset);
+            if (event->len > 0 && fileName == event->name) {
+                changed = true;
+            }
+            offset += sizeof(inotify_event) + event->len;
+        }
+    }
+    return changed;
+#else
+    std::error_code error;
+    auto current = std::filesystem::last_write_time(path, error);
+    if (error || current == lastWrite) return false;
+
+    lastWrite = current;
+    return true;
+#endif
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <filesystem>
+
+/*
+    Avisa quando um arquivo foi reescrito. No Linux usa inotify sobre o
+    diretorio (editores e ferramentas costumam salvar num temporario e
+    renomear); em outros sistemas compara a data de modificacao a cada Poll().
+*/
+class FileWatcher {
+    private:
+        std::string path;
+        std::string fileName;
+        int inotifyFd;
+        int watchDescriptor;
+        std::filesystem::file_time_type lastWrite;
+    public:
+        FileWatcher();
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        // O arquivo nao precisa existir ainda, so o diretorio
+        bool Watch(const std::string& path);
+        void Stop();
+        bool IsWatching() const { return !path.empty(); }
+
+        // Nao bloqueia; true se o arquivo mudou desde a ultima chamada
+        bool Poll();
+};
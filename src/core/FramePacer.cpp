@@ -0,0 +1,106 @@
+#include "FramePacer.hpp"
+#include <algorithm>
+
+FramePacer::FramePacer(double targetFps) {
+    frequency = SDL_GetPerformanceFrequency();
+    spinCounts = frequency / 1000; // 1 ms
+    idleMode = false;
+    nextDeadline = 0;
+    lastFrameStart = 0;
+    historyIndex = 0;
+    historyCount = 0;
+    renderedFrames = 0;
+    idleFrames = 0;
+    lastRendered = true;
+    history.fill(0.0f);
+    SetTargetFps(targetFps);
+}
+
+void FramePacer::SetTargetFps(double fps) {
+    targetFps = (fps > 0.0) ? fps : 0.0;
+    frameCounts = (targetFps > 0.0) ? (Uint64)(frequency / targetFps) : 0;
+    nextDeadline = 0;
+}
+
+void FramePacer::BeginFrame() {
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (lastFrameStart != 0) {
+        history[historyIndex] = (float)((double)(now - lastFrameStart) * 1000.0 / frequency);
+        historyIndex = (historyIndex + 1) % HistorySize;
+        if (historyCount < HistorySize) historyCount++;
+    }
+    lastFrameStart = now;
+}
+
+void FramePacer::EndFrame(bool rendered) {
+    lastRendered = rendered;
+    if (rendered) {
+        renderedFrames++;
+    } else {
+        idleFrames++;
+    }
+}
+
+void FramePacer::WaitForNextFrame() {
+    if (frameCounts == 0) {
+        // O evento fica na fila para o InputManager; acordar sem evento so repete o quadro ocioso
+        if (idleMode && !lastRendered) SDL_WaitEventTimeout(nullptr, IdleWaitMs);
+        return;
+    }
+
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    // Primeiro quadro, ou atraso maior que um quadro: realinha o prazo em vez de tentar compensar
+    if (nextDeadline == 0 || now > nextDeadline + frameCounts) {
+        nextDeadline = now + frameCounts;
+    }
+
+    while (now + spinCounts < nextDeadline) {
+        Uint64 remainingMs = (nextDeadline - now - spinCounts) * 1000 / frequency;
+        SDL_Delay(remainingMs > 0 ? (Uint32)remainingMs : 1);
+        now = SDL_GetPerformanceCounter();
+    }
+
+    while (now < nextDeadline) {
+        now = SDL_GetPerformanceCounter();
+    }
+
+    nextDeadline += frameCounts;
+}
+
+FrameStats FramePacer::GetStats() const {
+    FrameStats stats = {};
+    stats.samples = historyCount;
+    stats.renderedFrames = renderedFrames;
+    stats.idleFrames = idleFrames;
+
+    if (historyCount == 0) return stats;
+
+    std::array<float, HistorySize> sorted;
+    std::copy(history.begin(), history.begin() + historyCount, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + historyCount);
+
+    double total = 0.0;
+    for (int i = 0; i < historyCount; i++) {
+        total += sorted[i];
+    }
+
+    stats.averageMs = total / historyCount;
+    stats.minMs = sorted[0];
+    stats.maxMs = sorted[historyCount - 1];
+    stats.p99Ms = sorted[(historyCount - 1) * 99 / 100];
+    stats.fps = (stats.averageMs > 0.0) ? 1000.0 / stats.averageMs : 0.0;
+    return stats;
+}
+
+void FramePacer::PrintStats(std::ostream& out) const {
+    FrameStats stats = GetStats();
+
+    out << "Quadros: media " << stats.averageMs << " ms (" << stats.fps << " fps)"
+        << ", min " << stats.minMs << " ms"
+        << ", max " << stats.maxMs << " ms"
+        << ", p99 " << stats.p99Ms << " ms"
+        << ", renderizados " << stats.renderedFrames
+        << ", ociosos " << stats.idleFrames << std::endl;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <array>
+#include <ostream>
+#include <SDL2/SDL.h>
+
+struct FrameStats {
+    double averageMs;
+    double minMs;
+    double maxMs;
+    double p99Ms;
+    double fps;
+    int samples;
+    Uint64 renderedFrames;
+    Uint64 idleFrames;      // quadros em que nada mudou e a renderizacao foi pulada
+};
+
+/*
+    Limita a taxa de quadros dormindo (SDL_Delay) ate perto do prazo do
+    proximo quadro e girando apenas no ultimo sub-milissegundo.
+    No modo ocioso, o GameManager pula a renderizacao quando nada mudou; sem
+    limite de quadros, um quadro pulado espera o proximo evento (ate IdleWaitMs)
+    em vez de voltar na hora e girar o laco a 100% de CPU.
+*/
+class FramePacer {
+    private:
+        static constexpr int HistorySize = 240;
+        // Teto da espera ociosa: assets e arquivos observados chegam sem evento do SDL
+        static constexpr int IdleWaitMs = 16;
+
+        double targetFps;       // 0 = sem limite
+        bool idleMode;
+        Uint64 frequency;
+        Uint64 frameCounts;     // duracao de um quadro em unidades do SDL_GetPerformanceCounter
+        Uint64 spinCounts;      // janela final feita em espera ativa
+        Uint64 nextDeadline;
+        Uint64 lastFrameStart;
+
+        std::array<float, HistorySize> history;     // duracao dos ultimos quadros, em ms
+        int historyIndex;
+        int historyCount;
+        Uint64 renderedFrames;
+        Uint64 idleFrames;
+        bool lastRendered;
+    public:
+        FramePacer(double targetFps = 60.0);
+
+        void SetTargetFps(double fps);
+        double GetTargetFps() const { return targetFps; }
+        void SetIdleMode(bool enabled) { idleMode = enabled; }
+        bool IsIdleMode() const { return idleMode; }
+
+        // Marca o inicio de um quadro e registra a duracao do anterior
+        void BeginFrame();
+        void EndFrame(bool rendered);
+        // Dorme ate o prazo do proximo quadro; sem limite, so espera depois de um quadro ocioso
+        void WaitForNextFrame();
+
+        FrameStats GetStats() const;
+        void PrintStats(std::ostream& out) const;
+};
@@ -1,11 +1,46 @@
 #include "GameManager.hpp"
 #include <iostream>
+#include <random>
+#include <SDL2/SDL_image.h>
+#include <SDL2/SDL_ttf.h>
+#include <SDL2/SDL_mixer.h>
+#include "../scenes/SceneMap.hpp"
+#include "../scenes/SceneBattle.hpp"
 
-GameManager::GameManager() {
+static constexpr const char* CardFontPath = "assets/fonts/default.ttf";
+static constexpr int CardFontSize = 14;
+static constexpr const char* AssetPackPath = "assets.pak";
+static constexpr double AssetUploadBudgetMs = 2.0;
+static constexpr const char* CardDataPath = "assets/cards.bin";
+static constexpr const char* RunSavePath = "run.sav";
+
+GameManager::GameManager()
+    : assets(workers), autosave(workers, RunSavePath), scenes(workers, input, cardDatabase) {
     window = nullptr;
     renderer = nullptr;
-    currentWorld = nullptr;
+    viewportWidth = 0;
+    viewportHeight = 0;
     isRunning = false;
+    headless = false;
+    tickRate = 60.0;
+    maxCatchUpTicks = 5;
+    tickCounts = 0;
+    accumulator = 0;
+    cardFontApplied = false;
+    cardDatabase.AddBaseSet();
+    dirtyRegions = false;
+    backBuffer = nullptr;
+    fullRedraw = true;
+
+    input.quit.subscribe(Mylib::Event::make_callback_object<QuitEvent>(*this, &GameManager::OnQuit));
+    input.renderReset.subscribe(Mylib::Event::make_callback_object<RenderResetEvent>(*this, &GameManager::OnRenderReset));
+    input.key.subscribe(Mylib::Event::make_callback_object<KeyEvent>(*this, &GameManager::OnKey));
+
+    scenes.Register(SceneId::MAP, [](SceneManager& scenes) { return std::make_unique<SceneMap>(scenes); });
+    // Cada batalha sorteia com o gerador da subida: ao carregar o save, a mesma luta compra a mesma mao
+    scenes.Register(SceneId::BATTLE, [](SceneManager& scenes) {
+        return std::make_unique<SceneBattle>(scenes, scenes.GetRun()->GetRandom());
+    });
 }
 
 GameManager::~GameManager() {
@@ -25,14 +60,51 @@ bool GameManager::Initialize(const char* title, int x, int y, int width, int hei
         }
 
         renderer = SDL_CreateRenderer(window, -1, 0);
+        viewportWidth = width;
+        viewportHeight = height;
         if (renderer) {
             SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // Fundo preto
             SDL_RenderSetLogicalSize(renderer, width, height);
         }
 
+        if (!(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG)) {
+            std::cerr << "Erro ao inicializar SDL_image: " << IMG_GetError() << std::endl;
+        }
+
+        if (TTF_Init() == 0) {
+            text.SetRenderer(renderer);
+        } else {
+            std::cerr << "Erro ao inicializar SDL_ttf: " << TTF_GetError() << std::endl;
+        }
+
+        if (Mix_OpenAudio(MIX_DEFAULT_FREQUENCY, MIX_DEFAULT_FORMAT, 2, 2048) != 0) {
+            std::cerr << "Erro ao abrir o audio: " << Mix_GetError() << std::endl;
+        }
+
+        // Carregamento em segundo plano: o primeiro quadro aparece sem esperar pelos assets
+        assets.SetRenderer(renderer);
+        // Gerado por 'make pack'; sem ele os assets sao lidos direto de assets/
+        if (pack.Open(AssetPackPath)) {
+            std::cout << "Pacote " << AssetPackPath << ": " << pack.GetEntryCount() << " arquivos" << std::endl;
+            assets.MountPack(&pack);
+        }
+        atlasAsset = assets.LoadAtlas("assets");
+        cardFontData = assets.LoadFontData(CardFontPath);
+
+        // Gerado por 'make cards'; salvar de novo o arquivo atualiza as cartas sem reiniciar
+        LoadCardData();
+        cardDataWatcher.Watch(CardDataPath);
+
+        // Depois das cartas: o save so vale se todas as cartas do baralho existirem
+        StartRun();
+        scenes.SetRun(&run, &autosave);
+
         isRunning = true;
-        
-        currentWorld = new GameWorld();
+
+        // Entra no mapa assim que ele terminar de ser montado; o mapa ja pede a batalha
+        scenes.SetAssets(&assets);
+        scenes.SetViewportSize(width, height);
+        scenes.Push(SceneId::MAP);
         return true;
     } else {
         isRunning = false;
@@ -40,65 +112,255 @@ bool GameManager::Initialize(const char* title, int x, int y, int width, int hei
     }
 }
 
+bool GameManager::InitializeHeadless() {
+    if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) != 0) {
+        std::cerr << "Erro ao inicializar SDL: " << SDL_GetError() << std::endl;
+        isRunning = false;
+        return false;
+    }
+
+    headless = true;
+    isRunning = true;
+
+    LoadCardData();
+
+    // Subida fixa e sem autosave: a simulacao nao le nem escreve o save do jogador
+    run.Start(0);
+    scenes.SetRun(&run, nullptr);
+
+    scenes.Push(SceneId::BATTLE);
+    scenes.WaitPending();
+    scenes.ApplyPending();
+    return true;
+}
+
+void GameManager::StartRun() {
+    if (autosave.Load(cardDatabase, run)) {
+        std::cout << "Subida carregada de " << autosave.GetPath() << std::endl;
+        return;
+    }
+
+    std::random_device device;
+    uint64_t seed = (uint64_t)device() << 32 | device();
+    // Nada e gravado ainda: o primeiro save sai quando a primeira sala for resolvida
+    run.Start(seed);
+    std::cout << "Nova subida, semente " << seed << std::endl;
+}
+
 void GameManager::Run() {
-    Uint32 lastTime = SDL_GetTicks();
+    SetTickRate(tickRate);
+
+    Uint64 lastCounter = SDL_GetPerformanceCounter();
+    accumulator = 0;
 
     while (isRunning) {
-        Uint32 currentTime = SDL_GetTicks();
-        float dt = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
+        pacer.BeginFrame();
+
+        // Trocas de cena pedidas no quadro anterior acontecem aqui, fora do despacho de eventos
+        bool sceneChanged = scenes.ApplyPending();
+
+        Uint64 currentCounter = SDL_GetPerformanceCounter();
+        accumulator += currentCounter - lastCounter;
+        lastCounter = currentCounter;
+
+        bool hadEvents = HandleEvents();
+        bool assetsChanged = UpdateAssets();
+        bool cardsChanged = UpdateCardData();
+        // Textura ou carta nova pode mudar qualquer coisa na tela, sem um retangulo conhecido
+        if (assetsChanged || cardsChanged || sceneChanged) fullRedraw = true;
+
+        int ticks = 0;
+        while (accumulator >= tickCounts && ticks < maxCatchUpTicks) {
+            Update();
 
-        HandleEvents();
+            accumulator -= tickCounts;
+            ticks++;
+        }
+
+        // Quadro lento demais: descarta o atraso restante para evitar a espiral da morte
+        if (accumulator >= tickCounts) {
+            accumulator %= tickCounts;
+        }
+
+        // Modo ocioso: sem eventos e sem mudancas no mundo, a tela atual continua valida
+        bool changed = hadEvents || sceneChanged || assetsChanged || cardsChanged || scenes.NeedsRedraw();
+        bool render = !pacer.IsIdleMode() || changed;
+
+        if (render) {
+            Render((float)accumulator / (float)tickCounts);
+        }
+
+        pacer.EndFrame(render);
+        pacer.WaitForNextFrame();
+    }
+
+    pacer.PrintStats(std::cout);
+}
+
+void GameManager::RunHeadless(Uint64 ticks) {
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    for (Uint64 i = 0; i < ticks && isRunning; i++) {
         Update();
-        
-        if (currentWorld) currentWorld->Update(dt);
-        
-        Render();
     }
+
+    const double elapsed = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    std::cout << "Simulacao headless: " << ticks << " passos em " << elapsed << " s";
+    if (elapsed > 0.0) {
+        std::cout << " (" << (Uint64)(ticks / elapsed) << " passos/s)";
+    }
+    std::cout << std::endl;
 }
 
-void GameManager::HandleEvents() {
-    SDL_Event event;
-    SDL_PollEvent(&event);
-    
-    switch (event.type) {
-        case SDL_QUIT:
-            isRunning = false;
-            break;
-        case SDL_KEYDOWN:
-            if (event.key.keysym.sym == SDLK_F11) {
-                ToggleFullscreen();
-            }
+void GameManager::SetTickRate(double ticksPerSecond) {
+    if (ticksPerSecond > 0.0) {
+        tickRate = ticksPerSecond;
+        tickCounts = (Uint64)(SDL_GetPerformanceFrequency() / tickRate);
+        if (tickCounts == 0) tickCounts = 1;
+    }
+}
 
-            if (event.key.keysym.sym == SDLK_ESCAPE) {
-                Uint32 flags = SDL_GetWindowFlags(window);
+void GameManager::SetMaxCatchUpTicks(int ticks) {
+    if (ticks > 0) {
+        maxCatchUpTicks = ticks;
+    }
+}
 
-                if (flags & (SDL_WINDOW_FULLSCREEN | SDL_WINDOW_FULLSCREEN_DESKTOP)) {
-                    ToggleFullscreen(); 
-                } else {
-                    isRunning = false; 
-                }
-            }
-            break;
-        default:
-            break;
+bool GameManager::HandleEvents() {
+    return input.Poll() > 0;
+}
+
+void GameManager::OnQuit(QuitEvent& event) {
+    isRunning = false;
+}
+
+void GameManager::OnRenderReset(RenderResetEvent& event) {
+    // Faces em cache e a tela mantida nas regioes sujas desenhariam conteudo perdido
+    scenes.InvalidateRenderTargets(event.deviceLost);
+    if (event.deviceLost && backBuffer) {
+        SDL_DestroyTexture(backBuffer);
+        backBuffer = nullptr;
     }
+    fullRedraw = true;
 }
 
-void GameManager::Update() {}
+void GameManager::OnKey(KeyEvent& event) {
+    if (!event.pressed || event.repeat) return;
+
+    if (event.key == SDLK_F3) {
+        pacer.PrintStats(std::cout);
+    }
+
+    if (event.key == SDLK_F11) {
+        ToggleFullscreen();
+    }
+
+    if (event.key == SDLK_ESCAPE) {
+        Uint32 flags = SDL_GetWindowFlags(window);
+
+        if (flags & (SDL_WINDOW_FULLSCREEN | SDL_WINDOW_FULLSCREEN_DESKTOP)) {
+            ToggleFullscreen(); 
+        } else {
+            isRunning = false; 
+        }
+    }
+}
+
+void GameManager::Update() {
+    scenes.Update(GetFixedDeltaTime());
+}
+
+bool GameManager::UpdateAssets() {
+    bool changed = assets.Update(AssetUploadBudgetMs) > 0;
+
+    if (!cardFontApplied && (cardFontData.IsReady() || cardFontData.IsFailed())) {
+        cardFontApplied = true;
+
+        if (cardFontData.IsReady()) {
+            scenes.SetCardFont(text.GetFont(CardFontPath, CardFontSize, cardFontData.Get()->bytes));
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+bool GameManager::LoadCardData() {
+    CardDataFile file;
+    if (!file.Open(CardDataPath)) return false;
+
+    int changed = file.ApplyTo(cardDatabase);
+    if (changed < 0) {
+        std::cerr << "Cartas de " << CardDataPath << " ignoradas" << std::endl;
+        return false;
+    }
+
+    // O arquivo e fechado aqui: as definicoes guardam copias dos nomes
+    std::cout << "Cartas de " << CardDataPath << ": " << changed << " definicoes atualizadas" << std::endl;
+    return changed > 0;
+}
+
+bool GameManager::UpdateCardData() {
+    if (!cardDataWatcher.Poll()) return false;
+
+    // Cenas montando em segundo plano leem o banco; so muda com todas prontas
+    scenes.WaitPending();
+    return LoadCardData();
+}
+
+void GameManager::Render(float alpha) {
+    if (!renderer) return;
+    if (dirtyRegions && RenderDirtyRegions(alpha)) return;
 
-void GameManager::Render() {
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
 
-    if (currentWorld) {
-        currentWorld->Render(renderer);
+    scenes.Render(renderer, alpha);
+
+    SDL_RenderPresent(renderer);
+}
+
+bool GameManager::RenderDirtyRegions(float alpha) {
+    if (!backBuffer) {
+        backBuffer = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                       viewportWidth, viewportHeight);
+        if (!backBuffer) {
+            std::cerr << "Regioes sujas desativadas, sem render target: " << SDL_GetError() << std::endl;
+            dirtyRegions = false;
+            return false;
+        }
+        fullRedraw = true;
+    }
+
+    damage.Clear();
+    scenes.CollectDamage(damage);
+    if (fullRedraw) damage.AddFull();
+    damage.Resolve(viewportWidth, viewportHeight, regions);
+
+    if (!regions.empty()) {
+        SDL_SetRenderTarget(renderer, backBuffer);
+
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderFillRects(renderer, regions.data(), (int)regions.size());
+
+        scenes.Render(renderer, alpha, &regions);
+
+        SDL_SetRenderTarget(renderer, nullptr);
+        fullRedraw = false;
     }
 
+    // O conteudo da janela nao sobrevive ao Present: a imagem inteira e copiada, numa so chamada
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    SDL_RenderCopy(renderer, backBuffer, nullptr, nullptr);
     SDL_RenderPresent(renderer);
+    return true;
 }
 
 void GameManager::ToggleFullscreen() {
+    if (!window) return;
+
     Uint32 flags = SDL_GetWindowFlags(window);
 
     if (flags & SDL_WINDOW_FULLSCREEN_DESKTOP) {
@@ -109,12 +371,29 @@ void GameManager::ToggleFullscreen() {
 }
 
 void GameManager::Clean() {
-    if (currentWorld) {
-        delete currentWorld;
-        currentWorld = nullptr;
+    scenes.Clear();
+    atlasAsset.Reset();
+    cardFontData.Reset();
+    assets.Shutdown();
+    assets.MountPack(nullptr);
+    pack.Close();
+    text.Clear();
+    if (backBuffer) {
+        SDL_DestroyTexture(backBuffer);
+        backBuffer = nullptr;
+    }
+    if (renderer) {
+        SDL_DestroyRenderer(renderer);
+        renderer = nullptr;
+    }
+    if (window) {
+        SDL_DestroyWindow(window);
+        window = nullptr;
     }
-    SDL_DestroyWindow(window);
-    SDL_DestroyRenderer(renderer);
+    Mix_CloseAudio();
+    Mix_Quit();
+    TTF_Quit();
+    IMG_Quit();
     SDL_Quit();
     std::cout << "Jogo finalizado." << std::endl;
 }
\ No newline at end of file
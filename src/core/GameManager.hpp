@@ -1,22 +1,102 @@
 #pragma once
 #include <SDL2/SDL.h>
-#include "GameWorld.hpp"
+#include "InputManager.hpp"
+#include "FramePacer.hpp"
+#include "TextureAtlas.hpp"
+#include "TextRenderer.hpp"
+#include "ThreadPool.hpp"
+#include "AssetManager.hpp"
+#include "SceneManager.hpp"
+#include "DamageTracker.hpp"
+#include "FileWatcher.hpp"
+#include "Autosave.hpp"
+#include "../logic/CardData.hpp"
 
 class GameManager {
 private:
     bool isRunning;
+    bool headless;
     SDL_Window* window;
     SDL_Renderer* renderer;
-    GameWorld* currentWorld;
+    int viewportWidth, viewportHeight;
+    InputManager input;
+    FramePacer pacer;
+    TextRenderer text;
+    PackArchive pack;
+
+    // Declarado antes do AssetManager: as tarefas pendentes terminam antes do pool ser destruido
+    ThreadPool workers;
+    AssetManager assets;
+    AtlasHandle atlasAsset;
+    FontDataHandle cardFontData;
+    bool cardFontApplied;
+    CardDatabase cardDatabase;
+    // Arquivo de cartas opcional sobre o conjunto base; observado para recarga ao vivo
+    FileWatcher cardDataWatcher;
+    // Subida em andamento; o Autosave grava em segundo plano nos workers
+    RunState run;
+    Autosave autosave;
+    // Depois de workers e assets: e destruido antes deles, esperando as cenas em construcao
+    SceneManager scenes;
+
+    // Simulacao em passo fixo
+    double tickRate;          // passos de simulacao por segundo
+    int maxCatchUpTicks;      // maximo de passos executados por quadro antes de descartar o atraso
+    Uint64 tickCounts;        // duracao de um passo em unidades do SDL_GetPerformanceCounter
+    Uint64 accumulator;
+
+    // Regioes sujas: a cena e mantida numa textura e so o que mudou e redesenhado nela
+    bool dirtyRegions;
+    SDL_Texture* backBuffer;
+    bool fullRedraw;
+    DamageTracker damage;
+    std::vector<SDL_Rect> regions;
+
+    // false se nao ha suporte a render target; o chamador volta ao redesenho completo
+    bool RenderDirtyRegions(float alpha);
+    // Aplica o arquivo de cartas, se existir; true se alguma definicao mudou
+    bool LoadCardData();
+    // Continua a subida salva, se houver uma valida; senao comeca outra
+    void StartRun();
 public:
     GameManager();
     ~GameManager();
     bool Initialize(const char* title, int x, int y, int width, int height, bool fullscreen);
+    // Inicializa sem janela nem renderer, apenas para simular o mundo (CI, servidores)
+    bool InitializeHeadless();
     void Run();
-    void HandleEvents();
+    // Executa 'ticks' passos fixos o mais rapido possivel, sem renderizar
+    void RunHeadless(Uint64 ticks);
+    // Retorna true se algum evento foi processado
+    bool HandleEvents();
     void Update();
-    void Render();
+    // Envia assets carregados ao renderer dentro do orcamento do quadro; true se algo ficou pronto
+    bool UpdateAssets();
+    // Recarrega as definicoes se o arquivo de cartas mudou; true se algo mudou
+    bool UpdateCardData();
+    void Render(float alpha);
     void Clean();
     void ToggleFullscreen();
+    void OnQuit(QuitEvent& event);
+    void OnRenderReset(RenderResetEvent& event);
+    void OnKey(KeyEvent& event);
+    InputManager& GetInput() { return input; }
+    FramePacer& GetFramePacer() { return pacer; }
+    // nullptr enquanto o atlas ainda carrega
+    TextureAtlas* GetAtlas() { return atlasAsset.IsReady() ? &atlasAsset.Get()->atlas : nullptr; }
+    AssetManager& GetAssets() { return assets; }
+    ThreadPool& GetWorkers() { return workers; }
+    SceneManager& GetScenes() { return scenes; }
+    const CardDatabase& GetCardDatabase() const { return cardDatabase; }
+    TextRenderer& GetText() { return text; }
     bool Running() { return isRunning; }
-};
\ No newline at end of file
+    bool IsHeadless() const { return headless; }
+
+    void SetTickRate(double ticksPerSecond);
+    void SetMaxCatchUpTicks(int ticks);
+    // Redesenha so as areas que mudaram; vale a pena em renderer por software
+    void SetDirtyRegions(bool enabled) { dirtyRegions = enabled; fullRedraw = true; }
+    bool IsDirtyRegions() const { return dirtyRegions; }
+    double GetTickRate() const { return tickRate; }
+    float GetFixedDeltaTime() const { return (float)(1.0 / tickRate); }
+};
@@ -1,10 +1,23 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include "RenderQueue.hpp"
 
 class GameObject {
     public:
         virtual ~GameObject() {}
         virtual void Initialize() = 0;
+        // Chamado antes de cada passo fixo, para guardar o estado usado na interpolacao
+        virtual void StorePreviousState() {}
         virtual void Update(float dt) = 0;
-        virtual void Render(SDL_Renderer* renderer) = 0;
-};
\ No newline at end of file
+        // Indica se o objeto mudou visualmente no ultimo passo (usado pelo modo ocioso)
+        virtual bool NeedsRedraw() const { return false; }
+        // Enfileira as primitivas do objeto; o GameWorld envia tudo em lotes.
+        // alpha: fracao [0, 1) do proximo passo fixo ja decorrida, para interpolar entre estados
+        virtual void Render(RenderQueue& queue, float alpha) = 0;
+
+        // Retangulo usado no hit-testing do mouse; false se o objeto nao e clicavel
+        virtual bool GetBounds(SDL_Rect& out) const { return false; }
+        // Camada de desenho; entre objetos sobrepostos, o de camada maior recebe o mouse
+        virtual int GetLayer() const { return LAYER_BOARD; }
+        virtual void SetHovered(bool hovered) {}
+};
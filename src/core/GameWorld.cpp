@@ -1,34 +1,374 @@
 #include "GameWorld.hpp"
+#include "EntitySystems.hpp"
 #include "../objects/Card.hpp"
+#include <algorithm>
+#include <iostream>
 
-GameWorld::GameWorld() {
-    Card* carta1 = new Card("Guerreiro", CardType::CREATURE, 3, 100, 200);
-    Card* carta2 = new Card("Bola de Fogo", CardType::SPELL, 5, 250, 200);
-
-    AddObject(carta1);
-    AddObject(carta2);
+GameWorld::GameWorld(const CardDatabase& database)
+    : objectPool(256, 16), database(database), cardFaces(120, 180) {
+    input = nullptr;
+    mouseX = 0;
+    mouseY = 0;
+    dirty = true;
+    animating = false;
+    nextObjectPickId = 0;
+    hoveredId = SpatialHash::InvalidId;
+    dragged = InvalidEntity;
+    dragOffsetX = 0;
+    dragOffsetY = 0;
 }
 
 GameWorld::~GameWorld() {
-    for (auto obj : objects) {
-        delete obj;
+    UnbindInput();
+    Clear();
+}
+
+void GameWorld::Despawn(GameObject* obj) {
+    auto it = std::find_if(objects.begin(), objects.end(),
+        [obj](const PooledObject& pooled) { return pooled.object == obj; });
+    if (it == objects.end()) return;
+
+    PooledObject pooled = *it;
+    DamageObject(pooled.object);
+    objects.erase(it);
+    UnindexObject(pooled.pickId);
+    pooled.destroy(objectPool, pooled.object);
+
+    dirty = true;
+}
+
+void GameWorld::Clear() {
+    for (auto& pooled : objects) {
+        pooled.destroy(objectPool, pooled.object);
     }
     objects.clear();
+
+    for (auto card : cards) {
+        DestroyPooled<Card>(objectPool, card);
+    }
+    cards.clear();
+    entities.Clear();
+
+    picking.Clear();
+    pickObjects.clear();
+    hoveredId = SpatialHash::InvalidId;
+    dragged = InvalidEntity;
+
+    moved.clear();
+    objectMotion.clear();
+    MarkDirty();
+}
+
+Card* GameWorld::SpawnCard(CardId id, int x, int y) {
+    CardInstance instance;
+    instance.id = id;
+    return SpawnCard(instance, x, y);
 }
 
-void GameWorld::AddObject(GameObject* obj) {
-    objects.push_back(obj);
-    obj->Initialize();
+Card* GameWorld::SpawnCard(const CardInstance& instance, int x, int y) {
+    if (!database.IsValid(instance.id)) {
+        std::cerr << "Carta inexistente: " << instance.id << std::endl;
+        return nullptr;
+    }
+
+    EntityHandle handle = entities.Create();
+    entities.AddTransform(handle, x, y, 120, 180);
+    entities.AddHover(handle);
+    entities.AddCard(handle, instance);
+
+    Card* card = objectPool.allocate_construct_type<Card>(entities, database, handle);
+    cards.push_back(card);
+    card->Initialize();
+
+    dirty = true;
+    return card;
+}
+
+void GameWorld::DestroyCard(Card* card) {
+    auto it = std::find(cards.begin(), cards.end(), card);
+    if (it == cards.end()) return;
+
+    EntityHandle handle = card->GetHandle();
+    DamageItem(handle.index);
+    picking.Remove(handle.index);
+    if (hoveredId == handle.index) hoveredId = SpatialHash::InvalidId;
+    if (dragged == handle) dragged = InvalidEntity;
+
+    entities.Destroy(card->GetHandle());
+    cards.erase(it);
+    DestroyPooled<Card>(objectPool, card);
+
+    dirty = true;
+}
+
+void GameWorld::BindInput(InputManager& input) {
+    UnbindInput();
+
+    this->input = &input;
+    mouseMotionDescriptor = input.mouseMotion.subscribe(
+        Mylib::Event::make_callback_object<MouseMotionEvent>(*this, &GameWorld::OnMouseMotion));
+    mouseButtonDescriptor = input.mouseButton.subscribe(
+        Mylib::Event::make_callback_object<MouseButtonEvent>(*this, &GameWorld::OnMouseButton));
+}
+
+void GameWorld::UnbindInput() {
+    if (input && mouseMotionDescriptor.is_valid()) {
+        input->mouseMotion.unsubscribe(mouseMotionDescriptor);
+    }
+    if (input && mouseButtonDescriptor.is_valid()) {
+        input->mouseButton.unsubscribe(mouseButtonDescriptor);
+    }
+    input = nullptr;
+    dragged = InvalidEntity;
+}
+
+uint32_t GameWorld::IndexObject(GameObject* obj) {
+    SDL_Rect bounds;
+    if (!obj->GetBounds(bounds)) return SpatialHash::InvalidId;
+
+    uint32_t order = nextObjectPickId++;
+    uint32_t id = ObjectPickBit | order;
+    picking.Insert(id, bounds, obj->GetLayer(), order);
+    pickObjects[id] = obj;
+    return id;
+}
+
+void GameWorld::UnindexObject(uint32_t pickId) {
+    if (pickId == SpatialHash::InvalidId) return;
+
+    picking.Remove(pickId);
+    pickObjects.erase(pickId);
+    if (hoveredId == pickId) hoveredId = SpatialHash::InvalidId;
+}
+
+void GameWorld::SyncPicking() {
+    for (EntityHandle handle : entities.GetChanged()) {
+        uint32_t dense = entities.DenseIndex(handle);
+        if (dense == EntityStore::InvalidIndex || !entities.Has(dense, COMPONENT_TRANSFORM)) continue;
+
+        SDL_Rect rect = {
+            entities.transform.x[dense],
+            entities.transform.y[dense],
+            entities.transform.width[dense],
+            entities.transform.height[dense]
+        };
+
+        uint64_t order = EntityPickOrder(entities.depth[dense]);
+        SDL_Rect previous;
+        if (picking.GetRect(handle.index, previous)) {
+            AddMoved(previous, rect, moved);
+            picking.Update(handle.index, rect);
+            picking.SetOrder(handle.index, order);
+        } else {
+            damage.Add(rect);
+            picking.Insert(handle.index, rect, LAYER_CARDS, order);
+        }
+    }
+    entities.ClearChanged();
+}
+
+void GameWorld::DamageItem(uint32_t pickId) {
+    SDL_Rect rect;
+    if (pickId != SpatialHash::InvalidId && picking.GetRect(pickId, rect)) {
+        damage.Add(rect);
+    }
+}
+
+void GameWorld::DamageObject(GameObject* obj) {
+    SDL_Rect bounds;
+    if (obj->GetBounds(bounds)) {
+        damage.Add(bounds);
+    } else {
+        damage.AddFull();
+    }
+}
+
+void GameWorld::AddMoved(const SDL_Rect& from, const SDL_Rect& to, std::vector<SDL_Rect>& out) {
+    SDL_Rect swept;
+    SDL_UnionRect(&from, &to, &swept);
+    out.push_back(swept);
+    TrimMoved();
+}
+
+void GameWorld::TrimMoved() {
+    if (moved.size() + objectMotion.size() <= MaxMovedRects) return;
+
+    moved.clear();
+    objectMotion.clear();
+    damage.AddFull();
+}
+
+void GameWorld::SetHoveredId(uint32_t id, bool hovered) {
+    if (id == SpatialHash::InvalidId) return;
+    DamageItem(id);
+
+    if (id & ObjectPickBit) {
+        auto it = pickObjects.find(id);
+        if (it != pickObjects.end()) it->second->SetHovered(hovered);
+        return;
+    }
+
+    uint32_t dense = entities.DenseIndex(entities.HandleOfSlot(id));
+    if (dense != EntityStore::InvalidIndex && entities.Has(dense, COMPONENT_HOVER)) {
+        entities.hovered[dense] = hovered;
+    }
+}
+
+void GameWorld::UpdateHover() {
+    SyncPicking();
+
+    uint32_t id = picking.QueryPoint(mouseX, mouseY);
+    if (id == hoveredId) return;
+
+    SetHoveredId(hoveredId, false);
+    SetHoveredId(id, true);
+    hoveredId = id;
+    dirty = true;
+}
+
+EntityHandle GameWorld::PickEntity(int x, int y) {
+    SyncPicking();
+
+    uint32_t id = picking.QueryPoint(x, y);
+    if (id == SpatialHash::InvalidId || (id & ObjectPickBit)) return InvalidEntity;
+    return entities.HandleOfSlot(id);
+}
+
+GameObject* GameWorld::PickObject(int x, int y) {
+    SyncPicking();
+
+    uint32_t id = picking.QueryPoint(x, y);
+    if (id == SpatialHash::InvalidId || !(id & ObjectPickBit)) return nullptr;
+    return pickObjects[id];
+}
+
+void GameWorld::PickEntities(const SDL_Rect& rect, std::vector<EntityHandle>& out) {
+    SyncPicking();
+
+    std::vector<uint32_t> ids;
+    picking.QueryRect(rect, ids);
+
+    out.clear();
+    for (uint32_t id : ids) {
+        if (!(id & ObjectPickBit)) out.push_back(entities.HandleOfSlot(id));
+    }
+}
+
+void GameWorld::OnMouseMotion(MouseMotionEvent& event) {
+    mouseX = event.x;
+    mouseY = event.y;
+
+    uint32_t dense = entities.DenseIndex(dragged);
+    if (dense != EntityStore::InvalidIndex) {
+        entities.SetPosition(dense, mouseX - dragOffsetX, mouseY - dragOffsetY);
+        dirty = true;
+    }
+
+    UpdateHover();
+}
+
+void GameWorld::OnMouseButton(MouseButtonEvent& event) {
+    if (event.button != SDL_BUTTON_LEFT) return;
+
+    mouseX = event.x;
+    mouseY = event.y;
+
+    if (!event.pressed) {
+        if (dragged != InvalidEntity) {
+            // Sai da camada de sobreposicao: volta para baixo de quem estiver por cima
+            DamageItem(dragged.index);
+            dirty = true;
+        }
+        dragged = InvalidEntity;
+        return;
+    }
+
+    // So cartas sao arrastaveis; a carta pega passa para a frente das outras
+    EntityHandle handle = PickEntity(mouseX, mouseY);
+    uint32_t dense = entities.DenseIndex(handle);
+    if (dense == EntityStore::InvalidIndex || !entities.Has(dense, COMPONENT_CARD)) return;
+
+    dragged = handle;
+    dragOffsetX = mouseX - entities.transform.x[dense];
+    dragOffsetY = mouseY - entities.transform.y[dense];
+    // A mesma profundidade ordena o desenho e o clique; o SyncPicking leva ao indice
+    entities.BringToFront(dense);
+    DamageItem(handle.index);
+    dirty = true;
 }
 
 void GameWorld::Update(float dt) {
-    for (auto obj : objects) {
+    // Movimentos feitos fora do passo (ex.: arrastar com o mouse) tambem exigem redesenho
+    animating = AnyTransformMoved(entities);
+    // O ultimo trecho interpolado termina agora; a posicao final ainda precisa ser desenhada
+    if (animating) CollectMotionRects(entities, moved);
+    StorePreviousTransforms(entities);
+
+    moved.insert(moved.end(), objectMotion.begin(), objectMotion.end());
+    objectMotion.clear();
+
+    for (auto& pooled : objects) {
+        GameObject* obj = pooled.object;
+        obj->StorePreviousState();
         obj->Update(dt);
+
+        if (obj->NeedsRedraw()) {
+            animating = true;
+
+            SDL_Rect bounds, previous;
+            if (pooled.pickId != SpatialHash::InvalidId && obj->GetBounds(bounds) &&
+                picking.GetRect(pooled.pickId, previous)) {
+                AddMoved(previous, bounds, objectMotion);
+                picking.Update(pooled.pickId, bounds);
+            } else {
+                damage.AddFull();
+            }
+        }
     }
+
+    animating = animating || AnyTransformMoved(entities);
+    SyncPicking();
+    TrimMoved();
 }
 
-void GameWorld::Render(SDL_Renderer* renderer) {
-    for (auto obj : objects) {
-        obj->Render(renderer);
+void GameWorld::CollectDamage(DamageTracker& out) {
+    SyncPicking();
+
+    out.Add(damage);
+    damage.Clear();
+
+    // Entidades ainda interpolando: a posicao muda a cada quadro ate o proximo passo
+    CollectMotionRects(entities, moved);
+    moved.insert(moved.end(), objectMotion.begin(), objectMotion.end());
+
+    for (const SDL_Rect& rect : lastMoved) out.Add(rect);
+    for (const SDL_Rect& rect : moved) out.Add(rect);
+
+    lastMoved.swap(moved);
+    moved.clear();
+}
+
+void GameWorld::Render(SDL_Renderer* renderer, float alpha, const std::vector<SDL_Rect>* regions) {
+    if (!renderer) return;
+
+    cardFaces.SetRenderer(renderer);
+    // A carta arrastada vai por ultimo, na camada de sobreposicao
+    uint32_t draggedDense = entities.DenseIndex(dragged);
+    RenderCards(entities, database, renderQueue, alpha, &cardFaces, draggedDense);
+    if (draggedDense != EntityStore::InvalidIndex) {
+        RenderCard(entities, database, draggedDense, renderQueue, alpha, &cardFaces, LAYER_OVERLAY);
+    }
+
+    renderQueue.SetDepth(0);
+    for (auto& pooled : objects) {
+        pooled.object->Render(renderQueue, alpha);
     }
+
+    if (regions) {
+        renderQueue.Flush(renderer, *regions);
+    } else {
+        renderQueue.Flush(renderer);
+    }
+
+    dirty = false;
 }
\ No newline at end of file
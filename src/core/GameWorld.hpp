@@ -1,15 +1,141 @@
 #pragma once
 #include <vector>
+#include <utility>
+#include <unordered_map>
 #include <SDL2/SDL.h>
+#include <my-lib/memory-pool.h>
 #include "GameObject.hpp"
+#include "InputManager.hpp"
+#include "EntityStore.hpp"
+#include "RenderQueue.hpp"
+#include "CardFaceCache.hpp"
+#include "SpatialHash.hpp"
+#include "DamageTracker.hpp"
+#include "../logic/CardDatabase.hpp"
+
+class Card;
 
 class GameWorld {
     private:
-        std::vector<GameObject*> objects; 
+        using DestroyFunc = void (*)(Mylib::Memory::Manager& pool, GameObject* obj);
+
+        struct PooledObject {
+            GameObject* object;
+            DestroyFunc destroy;    // conhece o tipo concreto, para devolver o tamanho certo ao pool
+            uint32_t pickId;        // SpatialHash::InvalidId se o objeto nao e clicavel
+        };
+
+        // Acima disso as areas de movimento pendentes viram um redesenho completo
+        static constexpr size_t MaxMovedRects = 256;
+
+        // Ids no indice espacial: entidades usam o slot do handle; objetos, este bit + contador
+        static constexpr uint32_t ObjectPickBit = 1u << 31;
+        // Ordem no indice: objetos pela ordem de criacao; entidades pela profundidade, acima
+        // deles na mesma camada, como na RenderQueue (objetos sao desenhados com profundidade 0)
+        static uint64_t EntityPickOrder(uint32_t depth) { return (1ull << 32) | depth; }
+
+        // Todos os objetos do mundo sao alocados aqui; destruido junto com o mundo
+        Mylib::Memory::PoolManager objectPool;
+        std::vector<PooledObject> objects;
+
+        // Cartas vivem no EntityStore; os adaptadores Card apenas dao acesso a elas
+        const CardDatabase& database;
+        EntityStore entities;
+        std::vector<Card*> cards;
+
+        // Indice dos retangulos de entidades e objetos para hover/clique
+        SpatialHash picking;
+        std::unordered_map<uint32_t, GameObject*> pickObjects;
+        uint32_t nextObjectPickId;
+        uint32_t hoveredId;
+
+        EntityHandle dragged;
+        int dragOffsetX, dragOffsetY;
+
+        RenderQueue renderQueue;
+        CardFaceCache cardFaces;
+
+        InputManager* input;
+        Mylib::Event::Handler<MouseMotionEvent>::Descriptor mouseMotionDescriptor;
+        Mylib::Event::Handler<MouseButtonEvent>::Descriptor mouseButtonDescriptor;
+        int mouseX, mouseY;
+
+        bool dirty;         // mudanca explicita desde o ultimo quadro desenhado
+        bool animating;     // algum objeto se moveu no ultimo passo
+
+        // Modo de regioes sujas: o que mudou na tela desde o ultimo CollectDamage
+        DamageTracker damage;
+        std::vector<SDL_Rect> moved;        // areas varridas por objetos/entidades movidos
+        std::vector<SDL_Rect> objectMotion; // objetos interpolando ate o proximo passo
+        // Regioes de movimento do quadro anterior: apagam a ultima posicao interpolada desenhada
+        std::vector<SDL_Rect> lastMoved;
+
+        uint32_t IndexObject(GameObject* obj);
+        void UnindexObject(uint32_t pickId);
+        // Leva ao indice as entidades movidas desde a ultima sincronizacao
+        void SyncPicking();
+        void SetHoveredId(uint32_t id, bool hovered);
+        // Marca como suja a area registrada do item no indice
+        void DamageItem(uint32_t pickId);
+        void DamageObject(GameObject* obj);
+        void AddMoved(const SDL_Rect& from, const SDL_Rect& to, std::vector<SDL_Rect>& out);
+        void TrimMoved();
+        void UpdateHover();
+
+        template <typename T>
+        static void DestroyPooled(Mylib::Memory::Manager& pool, GameObject* obj) {
+            pool.destruct_deallocate_type<T>(static_cast<T*>(obj));
+        }
     public:
-        GameWorld();
+        GameWorld(const CardDatabase& database);
         ~GameWorld();
-        void AddObject(GameObject* obj);
+
+        // Cria um objeto no pool do mundo; ele e destruido por Despawn ou Clear
+        template <typename T, typename... Args>
+        T* Spawn(Args&&... args) {
+            static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "o pool nao garante alinhamento maior");
+            T* obj = objectPool.allocate_construct_type<T>(std::forward<Args>(args)...);
+            obj->Initialize();
+            objects.push_back({ obj, &DestroyPooled<T>, IndexObject(obj) });
+            DamageObject(obj);
+            dirty = true;
+            return obj;
+        }
+
+        void Despawn(GameObject* obj);
+        // Destroi todos os objetos e entidades de uma vez (saida de cena)
+        void Clear();
+        // nullptr se o id nao existe no CardDatabase
+        Card* SpawnCard(CardId id, int x, int y);
+        Card* SpawnCard(const CardInstance& instance, int x, int y);
+        void DestroyCard(Card* card);
+        EntityStore& GetEntities() { return entities; }
+        const CardDatabase& GetCardDatabase() const { return database; }
+        // Objetos do mundo consomem a entrada por aqui, sem consultar o SDL diretamente
+        void BindInput(InputManager& input);
+        // Nao pode ser chamado de dentro de um evento (a lista de inscritos esta sendo percorrida)
+        void UnbindInput();
+        void OnMouseMotion(MouseMotionEvent& event);
+        void OnMouseButton(MouseButtonEvent& event);
+
+        // Entidade/objeto mais acima no ponto; so retorna se o item do topo for do tipo pedido
+        EntityHandle PickEntity(int x, int y);
+        GameObject* PickObject(int x, int y);
+        // Entidades que intersectam o retangulo, de cima para baixo
+        void PickEntities(const SDL_Rect& rect, std::vector<EntityHandle>& out);
+        EntityHandle GetDragged() const { return dragged; }
+        InputManager* GetInput() { return input; }
+        int GetMouseX() const { return mouseX; }
+        int GetMouseY() const { return mouseY; }
         void Update(float dt);
-        void Render(SDL_Renderer* renderer);
+        // Mudanca sem retangulo conhecido: redesenha a tela inteira
+        void MarkDirty() { dirty = true; damage.AddFull(); }
+        bool NeedsRedraw() const { return dirty || animating; }
+        // Passa adiante as areas sujas desde a ultima chamada; uma vez por quadro desenhado
+        void CollectDamage(DamageTracker& out);
+        // regions != nullptr: so redesenha dentro delas (o fundo ja foi limpo pelo chamador)
+        void Render(SDL_Renderer* renderer, float alpha, const std::vector<SDL_Rect>* regions = nullptr);
+        int GetLastDrawCalls() const { return renderQueue.GetLastDrawCalls(); }
+        CardFaceCache& GetCardFaces() { return cardFaces; }
+        void SetCardFont(FontCache* font) { cardFaces.SetFont(font); MarkDirty(); }
 };
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include <string_view>
+#include <cstdint>
+
+// FNV-1a de 64 bits: nomes de cartas e caminhos dentro do .pak
+constexpr uint64_t HashFnv1a(std::string_view text) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : text) {
+        hash ^= (uint8_t)c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
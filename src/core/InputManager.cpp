@@ -0,0 +1,103 @@
+#include "InputManager.hpp"
+
+InputManager::InputManager() {
+    hasPendingMotion = false;
+    pendingMotion = {};
+    mouseX = 0;
+    mouseY = 0;
+}
+
+int InputManager::Poll() {
+    int dispatched = 0;
+
+    SDL_PumpEvents();
+
+    while (true) {
+        int count = SDL_PeepEvents(buffer.data(), MaxEventsPerPeep, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+        if (count <= 0) break;
+
+        for (int i = 0; i < count; i++) {
+            const SDL_Event& event = buffer[i];
+
+            if (event.type == SDL_MOUSEMOTION) {
+                if (hasPendingMotion) {
+                    pendingMotion.xrel += event.motion.xrel;
+                    pendingMotion.yrel += event.motion.yrel;
+                } else {
+                    pendingMotion.xrel = event.motion.xrel;
+                    pendingMotion.yrel = event.motion.yrel;
+                    hasPendingMotion = true;
+                    dispatched++;
+                }
+                pendingMotion.x = event.motion.x;
+                pendingMotion.y = event.motion.y;
+                pendingMotion.buttons = event.motion.state;
+                continue;
+            }
+
+            // Mantem a ordem: o movimento agrupado sai antes de cliques/teclas
+            FlushMotion();
+            Dispatch(event);
+            dispatched++;
+        }
+
+        if (count < MaxEventsPerPeep) break;
+    }
+
+    FlushMotion();
+    return dispatched;
+}
+
+void InputManager::FlushMotion() {
+    if (!hasPendingMotion) return;
+
+    hasPendingMotion = false;
+    mouseX = pendingMotion.x;
+    mouseY = pendingMotion.y;
+    mouseMotion.publish(pendingMotion);
+}
+
+void InputManager::Dispatch(const SDL_Event& event) {
+    switch (event.type) {
+        case SDL_QUIT:
+            quit.publish(QuitEvent {});
+            break;
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            key.publish(KeyEvent {
+                .key = event.key.keysym.sym,
+                .mod = event.key.keysym.mod,
+                .pressed = (event.type == SDL_KEYDOWN),
+                .repeat = (event.key.repeat != 0)
+            });
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            mouseX = event.button.x;
+            mouseY = event.button.y;
+            mouseButton.publish(MouseButtonEvent {
+                .x = event.button.x,
+                .y = event.button.y,
+                .button = event.button.button,
+                .clicks = event.button.clicks,
+                .pressed = (event.type == SDL_MOUSEBUTTONDOWN)
+            });
+            break;
+        case SDL_MOUSEWHEEL:
+            mouseWheel.publish(MouseWheelEvent { .x = event.wheel.x, .y = event.wheel.y });
+            break;
+        case SDL_WINDOWEVENT:
+            window.publish(WindowEvent {
+                .type = event.window.event,
+                .data1 = event.window.data1,
+                .data2 = event.window.data2
+            });
+            break;
+        case SDL_RENDER_TARGETS_RESET:
+        case SDL_RENDER_DEVICE_RESET:
+            renderReset.publish(RenderResetEvent { .deviceLost = (event.type == SDL_RENDER_DEVICE_RESET) });
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <array>
+#include <SDL2/SDL.h>
+#include <my-lib/event.h>
+
+struct QuitEvent {
+};
+
+struct KeyEvent {
+    SDL_Keycode key;
+    Uint16 mod;
+    bool pressed;
+    bool repeat;
+};
+
+struct MouseMotionEvent {
+    int x, y;
+    int xrel, yrel;     // deslocamento acumulado de todos os eventos agrupados
+    Uint32 buttons;
+};
+
+struct MouseButtonEvent {
+    int x, y;
+    Uint8 button;
+    Uint8 clicks;
+    bool pressed;
+};
+
+struct MouseWheelEvent {
+    int x, y;
+};
+
+// O conteudo dos render targets se perdeu; com 'deviceLost', todas as texturas tambem
+struct RenderResetEvent {
+    bool deviceLost;
+};
+
+struct WindowEvent {
+    Uint8 type;
+    int data1, data2;
+};
+
+/*
+    Esvazia a fila do SDL uma vez por quadro em um buffer pre-alocado e
+    despacha eventos tipados pelos Mylib::Event::Handler abaixo.
+    Movimentos de mouse consecutivos sao agrupados em um unico evento.
+*/
+class InputManager {
+    private:
+        static constexpr int MaxEventsPerPeep = 256;
+
+        std::array<SDL_Event, MaxEventsPerPeep> buffer;
+
+        MouseMotionEvent pendingMotion;
+        bool hasPendingMotion;
+        int mouseX, mouseY;
+
+        void Dispatch(const SDL_Event& event);
+        void FlushMotion();
+    public:
+        Mylib::Event::Handler<QuitEvent> quit;
+        Mylib::Event::Handler<KeyEvent> key;
+        Mylib::Event::Handler<MouseMotionEvent> mouseMotion;
+        Mylib::Event::Handler<MouseButtonEvent> mouseButton;
+        Mylib::Event::Handler<MouseWheelEvent> mouseWheel;
+        Mylib::Event::Handler<WindowEvent> window;
+        Mylib::Event::Handler<RenderResetEvent> renderReset;
+
+        InputManager();
+
+        // Retorna quantos eventos foram despachados (apos o agrupamento)
+        int Poll();
+
+        int GetMouseX() const { return mouseX; }
+        int GetMouseY() const { return mouseY; }
+};
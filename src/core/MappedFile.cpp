@@ -0,0 +1,94 @@
+#include "MappedFile.hpp"
+#include <filesystem>
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+MappedFile::MappedFile() {
+    data = nullptr;
+    size = 0;
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        std::cerr << "Erro ao ler " << path << ": " << strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
+    // mmap recusa tamanho 0, e nenhum formato cabe num arquivo vazio
+    if (info.st_size == 0) {
+        std::cerr << "Arquivo vazio: " << path << std::endl;
+        close(fd);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Erro ao mapear " << path << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    data = (const uint8_t*)mapping;
+    size = (size_t)info.st_size;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data) {
+        munmap((void*)data, size);
+    }
+    data = nullptr;
+    size = 0;
+}
+
+bool WriteFileAtomic(const std::string& path, const uint8_t* bytes, size_t size) {
+    const std::string temporary = path + ".tmp";
+
+    int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "Erro ao criar " << temporary << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    size_t written = 0;
+    while (written < size) {
+        ssize_t result = write(fd, bytes + written, size - written);
+        if (result < 0 && errno == EINTR) continue;
+        if (result <= 0) break;
+        written += (size_t)result;
+    }
+
+    // Os dados precisam estar no disco antes do rename, senao uma queda pode deixar o arquivo vazio
+    bool ok = written == size && fsync(fd) == 0;
+    if (!ok) std::cerr << "Erro ao escrever " << temporary << ": " << strerror(errno) << std::endl;
+    close(fd);
+    if (!ok) {
+        std::error_code ignored;
+        std::filesystem::remove(temporary, ignored);
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::cerr << "Erro ao substituir " << path << ": " << error.message() << std::endl;
+        return false;
+    }
+    return true;
+}
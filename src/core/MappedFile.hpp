@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/*
+    Arquivo inteiro mapeado em memoria, somente leitura. O mapeamento continua
+    valido depois de fechar o descritor; e desfeito no Close ou no destrutor.
+    Os formatos binarios (.pak, cartas, cache de mapas) validam o conteudo por
+    cima dele.
+*/
+class MappedFile {
+    private:
+        const uint8_t* data;
+        size_t size;
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // false se o arquivo nao existe (sem mensagem), esta vazio ou nao pode ser mapeado
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return data != nullptr; }
+
+        const uint8_t* GetData() const { return data; }
+        size_t GetSize() const { return size; }
+};
+
+/*
+    Grava 'bytes' em path + ".tmp", faz fsync e renomeia por cima de 'path':
+    quem le o arquivo (ou observa o diretorio) nunca ve um arquivo pela metade,
+    e uma queda no meio deixa o conteudo anterior inteiro.
+*/
+bool WriteFileAtomic(const std::string& path, const uint8_t* bytes, size_t size);
+
+inline bool WriteFileAtomic(const std::string& path, const std::vector<uint8_t>& bytes) {
+    return WriteFileAtomic(path, bytes.data(), bytes.size());
+}
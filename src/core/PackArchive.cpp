@@ -0,0 +1,394 @@
+#include "PackArchive.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+// LZ4 (bloco): token [literais] offset [extensao do match], ate a sequencia final so de literais
+
+static constexpr size_t Lz4MinMatch = 4;
+static constexpr size_t Lz4LastLiterals = 5;    // os ultimos 5 bytes sao sempre literais
+static constexpr size_t Lz4MatchFindLimit = 12; // o ultimo match comeca pelo menos 12 bytes antes do fim
+static constexpr int Lz4HashBits = 12;
+
+static uint32_t Load32(const uint8_t* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static void WriteLz4Length(std::vector<uint8_t>& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back((uint8_t)length);
+}
+
+static void WriteLz4Sequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength,
+                             size_t offset, size_t matchLength) {
+    const size_t extraMatch = matchLength >= Lz4MinMatch ? matchLength - Lz4MinMatch : 0;
+    out.push_back((uint8_t)((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(extraMatch, 15)));
+
+    if (literalLength >= 15) WriteLz4Length(out, literalLength - 15);
+    out.insert(out.end(), literals, literals + literalLength);
+
+    // Sequencia final: so literais
+    if (matchLength == 0) return;
+
+    out.push_back((uint8_t)(offset & 0xFF));
+    out.push_back((uint8_t)(offset >> 8));
+    if (extraMatch >= 15) WriteLz4Length(out, extraMatch - 15);
+}
+
+void Lz4Compress(const uint8_t* src, size_t size, std::vector<uint8_t>& out) {
+    out.clear();
+    out.reserve(size + size / 255 + 16);
+
+    size_t anchor = 0;
+    size_t pos = 0;
+
+    if (size > Lz4MatchFindLimit) {
+        std::vector<uint32_t> table((size_t)1 << Lz4HashBits, UINT32_MAX);
+        const size_t matchLimit = size - Lz4LastLiterals;
+
+        while (pos + Lz4MatchFindLimit <= size) {
+            const uint32_t sequence = Load32(src + pos);
+            const uint32_t slot = (sequence * 2654435761u) >> (32 - Lz4HashBits);
+            const uint32_t candidate = table[slot];
+            table[slot] = (uint32_t)pos;
+
+            if (candidate == UINT32_MAX || pos - candidate > 0xFFFF || Load32(src + candidate) != sequence) {
+                pos++;
+                continue;
+            }
+
+            size_t length = Lz4MinMatch;
+            while (pos + length < matchLimit && src[candidate + length] == src[pos + length]) {
+                length++;
+            }
+
+            WriteLz4Sequence(out, src + anchor, pos - anchor, pos - candidate, length);
+            pos += length;
+            anchor = pos;
+        }
+    }
+
+    WriteLz4Sequence(out, src + anchor, size - anchor, 0, 0);
+}
+
+static bool ReadLz4Length(const uint8_t* src, size_t srcSize, size_t& ip, size_t& length) {
+    uint8_t byte;
+    do {
+        if (ip >= srcSize) return false;
+        byte = src[ip++];
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+bool Lz4Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    size_t ip = 0;
+    size_t op = 0;
+
+    while (ip < srcSize) {
+        const uint8_t token = src[ip++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !ReadLz4Length(src, srcSize, ip, literalLength)) return false;
+        if (literalLength > srcSize - ip || literalLength > dstSize - op) return false;
+
+        if (literalLength > 0) memcpy(dst + op, src + ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == srcSize) break;
+
+        if (srcSize - ip < 2) return false;
+        const size_t offset = src[ip] | (src[ip + 1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return false;
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !ReadLz4Length(src, srcSize, ip, matchLength)) return false;
+        matchLength += Lz4MinMatch;
+        if (matchLength > dstSize - op) return false;
+
+        // Byte a byte: origem e destino podem se sobrepor (offset < comprimento)
+        const uint8_t* match = dst + op - offset;
+        for (size_t i = 0; i < matchLength; i++) {
+            dst[op + i] = match[i];
+        }
+        op += matchLength;
+    }
+
+    return op == dstSize;
+}
+
+// ---------------------------------------------------------------------------
+
+PackArchive::PackArchive() {
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    entries = nullptr;
+    names = nullptr;
+}
+
+PackArchive::~PackArchive() {
+    Close();
+}
+
+bool PackArchive::Open(const std::string& path) {
+    Close();
+    if (!file.Open(path)) return false;
+
+    data = file.GetData();
+    size = file.GetSize();
+
+    if (size < sizeof(PackHeader) || !Validate()) {
+        std::cerr << "Pacote invalido: " << path << std::endl;
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool PackArchive::Validate() {
+    header = (const PackHeader*)data;
+    if (memcmp(header->magic, PackMagic, sizeof(PackMagic)) != 0 || header->version != PackVersion) return false;
+
+    const uint64_t tocSize = (uint64_t)header->entryCount * sizeof(PackEntry);
+    if (header->tocOffset % alignof(PackEntry) != 0) return false;
+    if (header->tocOffset > size || tocSize > size - header->tocOffset) return false;
+    if (header->namesOffset > size || header->namesSize > size - header->namesOffset) return false;
+
+    entries = (const PackEntry*)(data + header->tocOffset);
+    names = (const char*)(data + header->namesOffset);
+
+    // Confere tudo uma vez aqui para que as leituras depois nao precisem checar limites
+    for (uint32_t i = 0; i < header->entryCount; i++) {
+        const PackEntry& entry = entries[i];
+        if (entry.offset > size || entry.storedSize > size - entry.offset) return false;
+        if ((uint64_t)entry.nameOffset + entry.nameLength > header->namesSize) return false;
+        if (!(entry.flags & PACK_ENTRY_LZ4) && entry.storedSize != entry.size) return false;
+        if (i > 0 && entries[i - 1].hash > entry.hash) return false;
+    }
+    return true;
+}
+
+void PackArchive::Close() {
+    file.Close();
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    entries = nullptr;
+    names = nullptr;
+}
+
+std::string_view PackArchive::GetName(const PackEntry& entry) const {
+    return std::string_view(names + entry.nameOffset, entry.nameLength);
+}
+
+const PackEntry* PackArchive::Find(std::string_view name) const {
+    if (!header) return nullptr;
+
+    const uint64_t hash = PackHash(name);
+    const PackEntry* end = entries + header->entryCount;
+    const PackEntry* it = std::lower_bound(entries, end, hash, [](const PackEntry& entry, uint64_t hash) {
+        return entry.hash < hash;
+    });
+
+    // Colisoes de hash ficam lado a lado
+    for (; it != end && it->hash == hash; ++it) {
+        if (GetName(*it) == name) return it;
+    }
+    return nullptr;
+}
+
+const uint8_t* PackArchive::View(const PackEntry& entry) const {
+    if (entry.flags & PACK_ENTRY_LZ4) return nullptr;
+    return data + entry.offset;
+}
+
+bool PackArchive::Read(const PackEntry& entry, std::vector<uint8_t>& out) const {
+    out.resize(entry.size);
+    if (entry.size == 0) return true;
+
+    if (!(entry.flags & PACK_ENTRY_LZ4)) {
+        memcpy(out.data(), data + entry.offset, entry.size);
+        return true;
+    }
+
+    if (!Lz4Decompress(data + entry.offset, entry.storedSize, out.data(), out.size())) {
+        std::cerr << "Entrada corrompida no pacote: " << GetName(entry) << std::endl;
+        out.clear();
+        return false;
+    }
+    return true;
+}
+
+// Fecha um SDL_RWFromConstMem cujo buffer foi alocado por nos
+static int CloseOwnedMemRW(SDL_RWops* rw) {
+    SDL_free(rw->hidden.mem.base);
+    SDL_FreeRW(rw);
+    return 0;
+}
+
+SDL_RWops* PackArchive::OpenRW(const PackEntry& entry) const {
+    if (entry.size == 0) return nullptr;
+
+    if (!(entry.flags & PACK_ENTRY_LZ4)) {
+        return SDL_RWFromConstMem(data + entry.offset, (int)entry.size);
+    }
+
+    uint8_t* buffer = (uint8_t*)SDL_malloc(entry.size);
+    if (!buffer) return nullptr;
+
+    if (!Lz4Decompress(data + entry.offset, entry.storedSize, buffer, entry.size)) {
+        std::cerr << "Entrada corrompida no pacote: " << GetName(entry) << std::endl;
+        SDL_free(buffer);
+        return nullptr;
+    }
+
+    SDL_RWops* rw = SDL_RWFromConstMem(buffer, (int)entry.size);
+    if (!rw) {
+        SDL_free(buffer);
+        return nullptr;
+    }
+    rw->close = CloseOwnedMemRW;
+    return rw;
+}
+
+SDL_RWops* PackArchive::OpenRW(std::string_view name) const {
+    const PackEntry* entry = Find(name);
+    return entry ? OpenRW(*entry) : nullptr;
+}
+
+// ---------------------------------------------------------------------------
+
+PackWriter::PackWriter(uint32_t alignment)
+    : alignment(alignment > 0 ? alignment : 1) {}
+
+void PackWriter::Add(const std::string& name, std::vector<uint8_t> bytes, bool compress) {
+    items.push_back({ name, std::move(bytes), compress });
+}
+
+bool PackWriter::AddFile(const std::string& name, const std::string& path, bool compress) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "Erro ao abrir " << path << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> bytes((size_t)file.tellg());
+    file.seekg(0);
+    file.read((char*)bytes.data(), bytes.size());
+    if (!file) {
+        std::cerr << "Erro ao ler " << path << std::endl;
+        return false;
+    }
+
+    Add(name, std::move(bytes), compress);
+    return true;
+}
+
+int PackWriter::AddDirectory(const std::string& directory, bool compress) {
+    namespace fs = std::filesystem;
+
+    std::error_code error;
+    if (!fs::is_directory(directory, error)) return 0;
+
+    int count = 0;
+    for (const auto& file : fs::recursive_directory_iterator(directory, error)) {
+        if (!file.is_regular_file()) continue;
+
+        // "./assets/x.png" e "assets/x.png" viram o mesmo nome usado pelo jogo
+        std::string name = file.path().lexically_normal().generic_string();
+        if (AddFile(name, file.path().string(), compress)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static void PadTo(std::vector<uint8_t>& out, uint64_t alignment) {
+    while (out.size() % alignment != 0) {
+        out.push_back(0);
+    }
+}
+
+static void Append(std::vector<uint8_t>& out, const void* bytes, size_t size) {
+    const uint8_t* begin = (const uint8_t*)bytes;
+    out.insert(out.end(), begin, begin + size);
+}
+
+bool PackWriter::Write(const std::string& path) {
+    std::vector<PackEntry> toc;
+    std::string nameTable;
+    toc.reserve(items.size());
+
+    PackHeader header = {};
+    memcpy(header.magic, PackMagic, sizeof(PackMagic));
+    header.version = PackVersion;
+    header.entryCount = (uint32_t)items.size();
+    header.alignment = alignment;
+
+    // Montado inteiro na memoria: o jogo pode estar com o .pak antigo mapeado
+    std::vector<uint8_t> out;
+    Append(out, &header, sizeof(header));
+
+    std::vector<uint8_t> compressed;
+    for (const Item& item : items) {
+        if (item.name.size() > UINT16_MAX || item.bytes.size() > INT32_MAX) {
+            std::cerr << "Entrada grande demais para o pacote: " << item.name << std::endl;
+            return false;
+        }
+
+        PadTo(out, alignment);
+
+        PackEntry entry = {};
+        entry.hash = PackHash(item.name);
+        entry.offset = out.size();
+        entry.size = (uint32_t)item.bytes.size();
+        entry.nameOffset = (uint32_t)nameTable.size();
+        entry.nameLength = (uint16_t)item.name.size();
+
+        const uint8_t* payload = item.bytes.data();
+        size_t payloadSize = item.bytes.size();
+
+        // PNG e OGG ja vem comprimidos: so guarda em LZ4 se economizar pelo menos 1/8
+        if (item.compress && !item.bytes.empty()) {
+            Lz4Compress(item.bytes.data(), item.bytes.size(), compressed);
+            if (compressed.size() < item.bytes.size() - item.bytes.size() / 8) {
+                payload = compressed.data();
+                payloadSize = compressed.size();
+                entry.flags |= PACK_ENTRY_LZ4;
+            }
+        }
+
+        entry.storedSize = (uint32_t)payloadSize;
+        Append(out, payload, payloadSize);
+
+        nameTable += item.name;
+        toc.push_back(entry);
+    }
+
+    std::sort(toc.begin(), toc.end(), [&nameTable](const PackEntry& a, const PackEntry& b) {
+        if (a.hash != b.hash) return a.hash < b.hash;
+        return nameTable.compare(a.nameOffset, a.nameLength, nameTable, b.nameOffset, b.nameLength) < 0;
+    });
+
+    PadTo(out, alignof(PackEntry));
+    header.tocOffset = out.size();
+    Append(out, toc.data(), toc.size() * sizeof(PackEntry));
+
+    header.namesOffset = out.size();
+    header.namesSize = nameTable.size();
+    Append(out, nameTable.data(), nameTable.size());
+
+    memcpy(out.data(), &header, sizeof(header));
+    return WriteFileAtomic(path, out);
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <SDL2/SDL.h>
+#include "Hash.hpp"
+#include "MappedFile.hpp"
+
+/*
+    Formato .pak (little-endian):
+        PackHeader
+        dados de cada arquivo, alinhados em 'alignment' bytes
+        indice: PackEntry[entryCount], ordenado por (hash, nome)
+        nomes: bytes UTF-8 concatenados, sem terminador
+*/
+static constexpr char PackMagic[4] = { 'A', 'P', 'A', 'K' };
+static constexpr uint32_t PackVersion = 1;
+
+struct PackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t alignment;
+    uint64_t tocOffset;
+    uint64_t namesOffset;
+    uint64_t namesSize;
+};
+
+enum PackEntryFlags : uint16_t {
+    PACK_ENTRY_LZ4 = 1 << 0     // dados em bloco LZ4; 'storedSize' bytes que expandem para 'size'
+};
+
+struct PackEntry {
+    uint64_t hash;
+    uint64_t offset;
+    uint32_t size;
+    uint32_t storedSize;
+    uint32_t nameOffset;
+    uint16_t nameLength;
+    uint16_t flags;
+};
+
+static_assert(sizeof(PackHeader) == 40 && sizeof(PackEntry) == 32, "layout do .pak mudou");
+
+// FNV-1a de 64 bits sobre o caminho com '/'
+constexpr uint64_t PackHash(std::string_view name) { return HashFnv1a(name); }
+
+// Compressao no formato de bloco do LZ4 (sem moldura)
+void Lz4Compress(const uint8_t* src, size_t size, std::vector<uint8_t>& out);
+bool Lz4Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+/*
+    Leitor de um .pak mapeado em memoria. Depois de aberto e somente leitura,
+    entao pode ser usado por varias threads ao mesmo tempo.
+*/
+class PackArchive {
+    private:
+        MappedFile file;
+        const uint8_t* data;
+        size_t size;
+        const PackHeader* header;
+        const PackEntry* entries;
+        const char* names;
+
+        bool Validate();
+    public:
+        PackArchive();
+        ~PackArchive();
+
+        PackArchive(const PackArchive&) = delete;
+        PackArchive& operator=(const PackArchive&) = delete;
+
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return file.IsOpen(); }
+
+        const PackEntry* Find(std::string_view name) const;
+        bool Contains(std::string_view name) const { return Find(name) != nullptr; }
+        std::string_view GetName(const PackEntry& entry) const;
+        uint32_t GetEntryCount() const { return header ? header->entryCount : 0; }
+        const PackEntry& GetEntry(uint32_t index) const { return entries[index]; }
+
+        // Ponteiro direto para o mapeamento; nullptr se a entrada estiver comprimida
+        const uint8_t* View(const PackEntry& entry) const;
+        // Copia (e descomprime, se preciso) o conteudo da entrada
+        bool Read(const PackEntry& entry, std::vector<uint8_t>& out) const;
+        /*
+            Fluxo SDL para IMG_Load_RW/Mix_LoadWAV_RW/TTF_OpenFontRW. Entradas sem
+            compressao apontam direto para o mapeamento, sem copia; as comprimidas
+            sao expandidas num buffer liberado pelo SDL_RWclose.
+        */
+        SDL_RWops* OpenRW(const PackEntry& entry) const;
+        SDL_RWops* OpenRW(std::string_view name) const;
+};
+
+// Monta um .pak; usado pela ferramenta pack_assets. Grava com WriteFileAtomic:
+// quem ja mapeou o .pak antigo continua lendo o arquivo antigo inteiro
+class PackWriter {
+    private:
+        struct Item {
+            std::string name;
+            std::vector<uint8_t> bytes;
+            bool compress;
+        };
+
+        std::vector<Item> items;
+        uint32_t alignment;
+    public:
+        PackWriter(uint32_t alignment = 16);
+
+        void Add(const std::string& name, std::vector<uint8_t> bytes, bool compress);
+        bool AddFile(const std::string& name, const std::string& path, bool compress);
+        // Adiciona todos os arquivos do diretorio (recursivo); o nome e o caminho normalizado com '/'
+        int AddDirectory(const std::string& directory, bool compress);
+
+        bool Write(const std::string& path);
+        size_t GetItemCount() const { return items.size(); }
+};
@@ -0,0 +1,171 @@
+#include "RenderQueue.hpp"
+#include <algorithm>
+
+RenderQueue::RenderQueue() {
+    depth = 0;
+    lastDrawCalls = 0;
+}
+
+void RenderQueue::Clear() {
+    commands.clear();
+    depth = 0;
+}
+
+void RenderQueue::FillRect(const SDL_Rect& rect, SDL_Color color, int16_t layer, SDL_BlendMode blend) {
+    commands.push_back({
+        layer, depth, blend, nullptr,
+        { (float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h },
+        { 0, 0, 0, 0 },
+        color
+    });
+}
+
+void RenderQueue::DrawRect(const SDL_Rect& rect, SDL_Color color, int16_t layer, int thickness) {
+    int t = std::min(thickness, std::min(rect.w, rect.h) / 2);
+    if (t <= 0) return;
+
+    FillRect({ rect.x, rect.y, rect.w, t }, color, layer);
+    FillRect({ rect.x, rect.y + rect.h - t, rect.w, t }, color, layer);
+    FillRect({ rect.x, rect.y + t, t, rect.h - 2 * t }, color, layer);
+    FillRect({ rect.x + rect.w - t, rect.y + t, t, rect.h - 2 * t }, color, layer);
+}
+
+void RenderQueue::DrawTexture(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst,
+                              SDL_Color mod, int16_t layer, SDL_BlendMode blend) {
+    if (!texture) return;
+
+    commands.push_back({
+        layer, depth, blend, texture,
+        { (float)dst.x, (float)dst.y, (float)dst.w, (float)dst.h },
+        src ? *src : SDL_Rect { 0, 0, 0, 0 },
+        mod
+    });
+}
+
+void RenderQueue::WriteQuad(const Command& cmd, float texW, float texH, SDL_Vertex* v, int* idx, int base) {
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    if (cmd.texture && cmd.src.w > 0) {
+        u0 = cmd.src.x / texW;
+        v0 = cmd.src.y / texH;
+        u1 = (cmd.src.x + cmd.src.w) / texW;
+        v1 = (cmd.src.y + cmd.src.h) / texH;
+    }
+
+    float x0 = cmd.dst.x, y0 = cmd.dst.y;
+    float x1 = cmd.dst.x + cmd.dst.w, y1 = cmd.dst.y + cmd.dst.h;
+
+    v[0] = { { x0, y0 }, cmd.color, { u0, v0 } };
+    v[1] = { { x1, y0 }, cmd.color, { u1, v0 } };
+    v[2] = { { x1, y1 }, cmd.color, { u1, v1 } };
+    v[3] = { { x0, y1 }, cmd.color, { u0, v1 } };
+
+    idx[0] = base;
+    idx[1] = base + 1;
+    idx[2] = base + 2;
+    idx[3] = base;
+    idx[4] = base + 2;
+    idx[5] = base + 3;
+}
+
+void RenderQueue::Sort() {
+    order.resize(commands.size());
+    for (uint32_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+
+    auto byState = [this](uint32_t a, uint32_t b) {
+        const Command& ca = commands[a];
+        const Command& cb = commands[b];
+        if (ca.layer != cb.layer) return ca.layer < cb.layer;
+        if (ca.depth != cb.depth) return ca.depth < cb.depth;
+        if (ca.blend != cb.blend) return ca.blend < cb.blend;
+        return std::less<SDL_Texture*>()(ca.texture, cb.texture);
+    };
+
+    // stable_sort: mesma camada, profundidade e estado mantem a ordem de envio.
+    // No caso comum (cartas enviadas de baixo para cima) a fila ja esta ordenada.
+    if (!std::is_sorted(order.begin(), order.end(), byState)) {
+        std::stable_sort(order.begin(), order.end(), byState);
+    }
+}
+
+static bool Touches(const SDL_FRect& dst, const SDL_Rect& clip) {
+    return dst.x < clip.x + clip.w && dst.x + dst.w > clip.x &&
+           dst.y < clip.y + clip.h && dst.y + dst.h > clip.y;
+}
+
+int RenderQueue::Submit(SDL_Renderer* renderer, const SDL_Rect* clip) {
+    int drawCalls = 0;
+
+    size_t i = 0;
+    while (i < order.size()) {
+        const Command& first = commands[order[i]];
+
+        size_t j = i + 1;
+        while (j < order.size()) {
+            const Command& cmd = commands[order[j]];
+            if (cmd.layer != first.layer || cmd.blend != first.blend || cmd.texture != first.texture) break;
+            j++;
+        }
+
+        float texW = 1.0f, texH = 1.0f;
+        if (first.texture) {
+            int w, h;
+            SDL_QueryTexture(first.texture, nullptr, nullptr, &w, &h);
+            texW = (float)w;
+            texH = (float)h;
+        }
+
+        vertices.resize((j - i) * 4);
+        indices.resize((j - i) * 6);
+
+        // Com recorte, quads fora da regiao nem chegam ao renderer
+        size_t quads = 0;
+        for (size_t q = i; q < j; q++) {
+            const Command& cmd = commands[order[q]];
+            if (clip && !Touches(cmd.dst, *clip)) continue;
+
+            WriteQuad(cmd, texW, texH, &vertices[quads * 4], &indices[quads * 6], (int)(quads * 4));
+            quads++;
+        }
+
+        if (quads > 0) {
+            if (first.texture) {
+                SDL_SetTextureBlendMode(first.texture, first.blend);
+            } else {
+                SDL_SetRenderDrawBlendMode(renderer, first.blend);
+            }
+
+            SDL_RenderGeometry(renderer, first.texture, vertices.data(), (int)(quads * 4),
+                               indices.data(), (int)(quads * 6));
+            drawCalls++;
+        }
+        i = j;
+    }
+
+    return drawCalls;
+}
+
+int RenderQueue::Flush(SDL_Renderer* renderer) {
+    Sort();
+    int drawCalls = Submit(renderer, nullptr);
+
+    Clear();
+    lastDrawCalls = drawCalls;
+    return drawCalls;
+}
+
+int RenderQueue::Flush(SDL_Renderer* renderer, const std::vector<SDL_Rect>& regions) {
+    Sort();
+
+    int drawCalls = 0;
+    for (const SDL_Rect& region : regions) {
+        SDL_RenderSetClipRect(renderer, &region);
+        drawCalls += Submit(renderer, &region);
+    }
+    SDL_RenderSetClipRect(renderer, nullptr);
+
+    Clear();
+    lastDrawCalls = drawCalls;
+    return drawCalls;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <SDL2/SDL.h>
+#include "Sprite.hpp"
+
+// Camadas de desenho: a fila ordena primeiro por camada, depois por profundidade e estado (blend, textura)
+enum RenderLayer : int16_t {
+    LAYER_BACKGROUND = 0,
+    LAYER_BOARD      = 10,
+    LAYER_CARDS      = 20,
+    LAYER_UI         = 30,
+    LAYER_OVERLAY    = 40
+};
+
+/*
+    Coleta primitivas de todos os objetos durante o GameWorld::Render e as envia
+    agrupadas: cada sequencia com a mesma camada/blend/textura vira uma unica
+    chamada de SDL_RenderGeometry. A cor vai nos vertices, entao trocar de cor
+    nao quebra o lote. Dentro de um lote a ordem de envio e preservada.
+    A profundidade (SetDepth) empilha objetos da mesma camada: as primitivas de
+    uma carta mais funda saem antes das de uma carta por cima, qualquer que seja
+    a textura.
+*/
+class RenderQueue {
+    private:
+        struct Command {
+            int16_t layer;
+            uint32_t depth;
+            SDL_BlendMode blend;
+            SDL_Texture* texture;
+            SDL_FRect dst;
+            SDL_Rect src;           // w == 0: textura inteira
+            SDL_Color color;
+        };
+
+        std::vector<Command> commands;
+        std::vector<uint32_t> order;
+        // Buffers reaproveitados entre quadros
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+
+        uint32_t depth;
+        int lastDrawCalls;
+
+        static void WriteQuad(const Command& cmd, float texW, float texH, SDL_Vertex* v, int* idx, int base);
+        // Preenche 'order' agrupando por camada/estado
+        void Sort();
+        // Envia os lotes na ordem de 'order'; com 'clip', so os quads que tocam o retangulo
+        int Submit(SDL_Renderer* renderer, const SDL_Rect* clip);
+    public:
+        RenderQueue();
+
+        void Clear();
+        size_t Size() const { return commands.size(); }
+        // Profundidade dos comandos seguintes, dentro da camada; volta a 0 no Flush
+        void SetDepth(uint32_t depth) { this->depth = depth; }
+
+        void FillRect(const SDL_Rect& rect, SDL_Color color, int16_t layer = LAYER_BOARD,
+                      SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+        // Contorno de 'thickness' pixels, feito de quatro retangulos
+        void DrawRect(const SDL_Rect& rect, SDL_Color color, int16_t layer = LAYER_BOARD, int thickness = 1);
+        void DrawTexture(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst,
+                         SDL_Color mod = { 255, 255, 255, 255 }, int16_t layer = LAYER_BOARD,
+                         SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+        void DrawSprite(const Sprite& sprite, const SDL_Rect& dst, SDL_Color mod = { 255, 255, 255, 255 },
+                        int16_t layer = LAYER_BOARD) {
+            DrawTexture(sprite.texture, &sprite.src, dst, mod, layer);
+        }
+
+        // Ordena, envia ao renderer e limpa a fila; retorna o numero de chamadas de desenho
+        int Flush(SDL_Renderer* renderer);
+        // Idem, mas redesenha apenas dentro das regioes (disjuntas), uma passada recortada por regiao
+        int Flush(SDL_Renderer* renderer, const std::vector<SDL_Rect>& regions);
+        int GetLastDrawCalls() const { return lastDrawCalls; }
+};
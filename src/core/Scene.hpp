@@ -0,0 +1,85 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <SDL2/SDL.h>
+#include "GameWorld.hpp"
+#include "InputManager.hpp"
+#include "AssetManager.hpp"
+#include "RenderQueue.hpp"
+#include "../objects/ui/Node.hpp"
+
+class SceneManager;
+
+enum class SceneId : uint8_t {
+    MAP,
+    BATTLE
+};
+
+/*
+    Ciclo de vida de uma cena:
+        Preload     thread principal: pede os assets ao AssetManager
+        Build       thread de trabalho: monta o mundo; nao pode tocar no SDL nem em outras cenas
+        Enter/Exit  thread principal, entre quadros: a cena chegou/saiu do topo da pilha
+    Uma cena fora da pilha continua em cache e volta sem ser reconstruida, a menos
+    que saia com Pop(true): ai a proxima Preload monta outra (ex.: uma batalha por sala).
+*/
+class Scene {
+    protected:
+        SceneManager& scenes;
+        GameWorld world;
+        // Interface por cima do mundo; montada no Build, desenhada numa fila propria
+        UiRoot ui;
+        RenderQueue uiQueue;
+
+        // Assets que precisam estar prontos (ou ter falhado) antes da cena entrar
+        std::vector<TextureHandle> textures;
+        std::vector<SoundHandle> sounds;
+    public:
+        Scene(SceneManager& scenes, const CardDatabase& database) : scenes(scenes), world(database), ui(0, 0) {}
+        virtual ~Scene() {}
+
+        virtual void Preload(AssetManager& assets) {}
+        virtual void Build() = 0;
+        virtual void Enter(InputManager& input) {
+            world.BindInput(input);
+            ui.BindInput(input);
+            world.MarkDirty();
+        }
+        virtual void Exit() {
+            ui.UnbindInput();
+            world.UnbindInput();
+        }
+        virtual void Update(float dt) { world.Update(dt); }
+        virtual bool NeedsRedraw() const { return world.NeedsRedraw() || ui.NeedsRedraw(); }
+        // Mundo e UI; com modo de regioes sujas, chamado uma vez antes de cada Render
+        virtual void CollectDamage(DamageTracker& damage) {
+            world.CollectDamage(damage);
+            ui.CollectDamage(damage);
+        }
+        virtual void Render(SDL_Renderer* renderer, float alpha, const std::vector<SDL_Rect>* regions = nullptr) {
+            world.Render(renderer, alpha, regions);
+            ui.Render(uiQueue);
+            if (regions) {
+                uiQueue.Flush(renderer, *regions);
+            } else {
+                uiQueue.Flush(renderer);
+            }
+        }
+        virtual void SetFont(FontCache* font) {
+            if (world.GetCardFaces().GetFont() != font) world.SetCardFont(font);
+            ui.SetFont(font);
+        }
+
+        bool AssetsSettled() const {
+            for (const auto& texture : textures) {
+                if (!texture.IsReady() && !texture.IsFailed()) return false;
+            }
+            for (const auto& sound : sounds) {
+                if (!sound.IsReady() && !sound.IsFailed()) return false;
+            }
+            return true;
+        }
+
+        GameWorld& GetWorld() { return world; }
+        UiRoot& GetUi() { return ui; }
+};
@@ -0,0 +1,261 @@
+#include "SceneManager.hpp"
+#include <algorithm>
+#include <iostream>
+#include "Autosave.hpp"
+
+SceneManager::SceneManager(ThreadPool& pool, InputManager& input, const CardDatabase& database)
+    : pool(pool), input(input), database(database) {
+    assets = nullptr;
+    cardFont = nullptr;
+    cardFaceBudget = CardFaceCache::DefaultBudget;
+    run = nullptr;
+    autosave = nullptr;
+    viewportWidth = 0;
+    viewportHeight = 0;
+    cacheSize = 2;
+    useCounter = 0;
+    building = 0;
+}
+
+SceneManager::~SceneManager() {
+    Clear();
+}
+
+void SceneManager::Register(SceneId id, Factory factory) {
+    factories[id] = std::move(factory);
+}
+
+SceneManager::Entry* SceneManager::Find(SceneId id) {
+    auto it = entries.find(id);
+    return it != entries.end() ? it->second.get() : nullptr;
+}
+
+bool SceneManager::InStack(SceneId id) const {
+    return std::find(stack.begin(), stack.end(), id) != stack.end();
+}
+
+bool SceneManager::IsPending(SceneId id) const {
+    return std::any_of(pending.begin(), pending.end(), [id](const Transition& transition) {
+        return transition.type != TransitionType::POP && transition.id == id;
+    });
+}
+
+void SceneManager::Preload(SceneId id) {
+    if (Find(id)) return;
+
+    auto factory = factories.find(id);
+    if (factory == factories.end()) {
+        std::cerr << "Cena nao registrada: " << (int)id << std::endl;
+        return;
+    }
+
+    auto entry = std::make_unique<Entry>();
+    entry->scene = factory->second(*this);
+    entry->lastUsed = ++useCounter;
+
+    if (assets) {
+        entry->scene->Preload(*assets);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(buildMutex);
+        building++;
+    }
+
+    // A Entry fica no heap: o ponteiro continua valido mesmo que o mapa cresca
+    Entry* target = entry.get();
+    entries[id] = std::move(entry);
+
+    pool.Submit([this, target] {
+        target->scene->Build();
+        target->built.store(true, std::memory_order_release);
+
+        std::lock_guard<std::mutex> lock(buildMutex);
+        building--;
+        if (building == 0) {
+            buildDone.notify_all();
+        }
+    });
+}
+
+bool SceneManager::IsReady(SceneId id) {
+    Entry* entry = Find(id);
+    return entry && entry->built.load(std::memory_order_acquire) && entry->scene->AssetsSettled();
+}
+
+void SceneManager::Push(SceneId id) {
+    Preload(id);
+    pending.push_back({ TransitionType::PUSH, id });
+}
+
+void SceneManager::Switch(SceneId id) {
+    Preload(id);
+    pending.push_back({ TransitionType::SWITCH, id });
+}
+
+void SceneManager::Pop(bool discard) {
+    pending.push_back({ TransitionType::POP, SceneId::MAP, discard });
+}
+
+void SceneManager::SetCardFont(FontCache* font) {
+    cardFont = font;
+
+    if (Scene* active = GetActive()) {
+        active->SetFont(font);
+    }
+}
+
+void SceneManager::SetCardFaceBudget(size_t bytes) {
+    cardFaceBudget = bytes;
+
+    if (Scene* active = GetActive()) {
+        active->GetWorld().GetCardFaces().SetBudget(bytes);
+    }
+}
+
+void SceneManager::InvalidateRenderTargets(bool texturesLost) {
+    // So as construidas: as outras ainda nao desenharam nada, e a Build pode estar rodando
+    for (auto& [id, entry] : entries) {
+        if (!entry->built.load(std::memory_order_acquire)) continue;
+
+        entry->scene->GetWorld().GetCardFaces().InvalidateAll(texturesLost);
+        entry->scene->GetWorld().MarkDirty();
+    }
+}
+
+void SceneManager::SaveRun() {
+    if (run && autosave) autosave->Save(*run);
+}
+
+void SceneManager::SetViewportSize(int width, int height) {
+    viewportWidth = width;
+    viewportHeight = height;
+
+    if (Scene* active = GetActive()) {
+        active->GetUi().SetSize(width, height);
+    }
+}
+
+void SceneManager::EnterTop() {
+    Entry* entry = Find(stack.back());
+    entry->lastUsed = ++useCounter;
+
+    entry->scene->SetFont(cardFont);
+    entry->scene->GetWorld().GetCardFaces().SetBudget(cardFaceBudget);
+    entry->scene->GetUi().SetSize(viewportWidth, viewportHeight);
+    entry->scene->Enter(input);
+}
+
+void SceneManager::ExitTop() {
+    Find(stack.back())->scene->Exit();
+}
+
+bool SceneManager::ApplyPending() {
+    bool changed = false;
+
+    while (!pending.empty()) {
+        Transition transition = pending.front();
+
+        if (transition.type == TransitionType::POP) {
+            pending.pop_front();
+            if (stack.size() <= 1) continue;
+
+            SceneId top = stack.back();
+            ExitTop();
+            stack.pop_back();
+            if (transition.discard && !InStack(top) && !IsPending(top)) {
+                entries.erase(top);
+            }
+            EnterTop();
+            changed = true;
+            continue;
+        }
+
+        if (InStack(transition.id)) {
+            std::cerr << "Cena ja esta na pilha: " << (int)transition.id << std::endl;
+            pending.pop_front();
+            continue;
+        }
+
+        // Destino ainda carregando: a cena atual segue e tentamos de novo no proximo quadro
+        if (!IsReady(transition.id)) break;
+        pending.pop_front();
+
+        if (!stack.empty()) {
+            ExitTop();
+            if (transition.type == TransitionType::SWITCH) {
+                stack.pop_back();
+            }
+        }
+
+        stack.push_back(transition.id);
+        EnterTop();
+        changed = true;
+    }
+
+    if (changed) {
+        EvictUnused();
+    }
+    return changed;
+}
+
+void SceneManager::EvictUnused() {
+    std::vector<std::pair<uint64_t, SceneId>> cached;
+    for (auto& [id, entry] : entries) {
+        if (InStack(id) || IsPending(id)) continue;
+        if (!entry->built.load(std::memory_order_acquire)) continue;
+        cached.push_back({ entry->lastUsed, id });
+    }
+
+    if (cached.size() <= cacheSize) return;
+
+    // Mais recentes primeiro; o que passar do limite e destruido
+    std::sort(cached.begin(), cached.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (size_t i = cacheSize; i < cached.size(); i++) {
+        entries.erase(cached[i].second);
+    }
+}
+
+void SceneManager::WaitPending() {
+    std::unique_lock<std::mutex> lock(buildMutex);
+    buildDone.wait(lock, [this] { return building == 0; });
+}
+
+void SceneManager::Clear() {
+    WaitPending();
+
+    if (!stack.empty()) {
+        ExitTop();
+    }
+    stack.clear();
+    pending.clear();
+    entries.clear();
+}
+
+Scene* SceneManager::GetActive() {
+    if (stack.empty()) return nullptr;
+    return Find(stack.back())->scene.get();
+}
+
+void SceneManager::Update(float dt) {
+    if (Scene* active = GetActive()) {
+        active->Update(dt);
+    }
+}
+
+bool SceneManager::NeedsRedraw() {
+    Scene* active = GetActive();
+    return active && active->NeedsRedraw();
+}
+
+void SceneManager::CollectDamage(DamageTracker& damage) {
+    if (Scene* active = GetActive()) {
+        active->CollectDamage(damage);
+    }
+}
+
+void SceneManager::Render(SDL_Renderer* renderer, float alpha, const std::vector<SDL_Rect>* regions) {
+    if (Scene* active = GetActive()) {
+        active->Render(renderer, alpha, regions);
+    }
+}
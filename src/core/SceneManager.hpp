@@ -0,0 +1,125 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <unordered_map>
+#include <SDL2/SDL.h>
+#include "Scene.hpp"
+#include "ThreadPool.hpp"
+#include "InputManager.hpp"
+#include "AssetManager.hpp"
+#include "TextRenderer.hpp"
+
+class RunState;
+class Autosave;
+
+/*
+    Pilha de cenas. So a cena do topo recebe Update/Render e entrada.
+    Push/Switch/Pop apenas agendam a troca: ela acontece em ApplyPending(),
+    no inicio do quadro, e so quando a cena de destino ja foi construida
+    e seus assets carregaram. Ate la a cena atual continua rodando.
+*/
+class SceneManager {
+    public:
+        using Factory = std::function<std::unique_ptr<Scene>(SceneManager&)>;
+    private:
+        struct Entry {
+            std::unique_ptr<Scene> scene;
+            std::atomic<bool> built = false;    // Build() terminou na thread de trabalho
+            uint64_t lastUsed = 0;
+        };
+
+        enum class TransitionType : uint8_t {
+            PUSH,
+            SWITCH,
+            POP
+        };
+
+        struct Transition {
+            TransitionType type;
+            SceneId id;
+            bool discard = false;   // POP: destroi a cena que sai em vez de guarda-la
+        };
+
+        ThreadPool& pool;
+        InputManager& input;
+        const CardDatabase& database;
+        AssetManager* assets;
+        FontCache* cardFont;
+        size_t cardFaceBudget;
+        RunState* run;
+        Autosave* autosave;
+
+        std::unordered_map<SceneId, Factory> factories;
+        std::unordered_map<SceneId, std::unique_ptr<Entry>> entries;
+        std::vector<SceneId> stack;
+        std::deque<Transition> pending;
+
+        int viewportWidth, viewportHeight;
+        size_t cacheSize;       // cenas fora da pilha mantidas construidas
+        uint64_t useCounter;
+
+        std::mutex buildMutex;
+        std::condition_variable buildDone;
+        int building;
+
+        Entry* Find(SceneId id);
+        bool InStack(SceneId id) const;
+        bool IsPending(SceneId id) const;
+        void EnterTop();
+        void ExitTop();
+        void EvictUnused();
+    public:
+        SceneManager(ThreadPool& pool, InputManager& input, const CardDatabase& database);
+        ~SceneManager();
+
+        SceneManager(const SceneManager&) = delete;
+        SceneManager& operator=(const SceneManager&) = delete;
+
+        void Register(SceneId id, Factory factory);
+        // Sem AssetManager (headless), as cenas nao carregam assets
+        void SetAssets(AssetManager* assets) { this->assets = assets; }
+        void SetCacheSize(size_t scenes) { cacheSize = scenes; }
+        // Compartilhado por todas as cenas; so muda no recarregamento, sem construcoes em andamento
+        const CardDatabase& GetCardDatabase() const { return database; }
+        // Subida em andamento, compartilhada pelas cenas; so muda na thread principal, fora do Build
+        void SetRun(RunState* run, Autosave* autosave) { this->run = run; this->autosave = autosave; }
+        RunState* GetRun() { return run; }
+        // Agenda a gravacao do estado atual da subida; sem Autosave (headless) nao faz nada
+        void SaveRun();
+        // Tamanho logico da tela, usado no layout da UI das cenas
+        void SetViewportSize(int width, int height);
+        // Aplicada a cada cena quando ela entra
+        void SetCardFont(FontCache* font);
+        // Orcamento do CardFaceCache de cada cena, aplicado quando ela entra
+        void SetCardFaceBudget(size_t bytes);
+        // Render targets perdidos: as faces em cache de todas as cenas prontas sao refeitas
+        void InvalidateRenderTargets(bool texturesLost);
+
+        // Comeca a construir a cena em segundo plano, se ela ainda nao estiver em cache
+        void Preload(SceneId id);
+        bool IsReady(SceneId id);
+
+        void Push(SceneId id);
+        // Troca a cena do topo; a anterior sai da pilha e fica em cache
+        void Switch(SceneId id);
+        // Com 'discard', a cena que sai e destruida: a proxima Preload monta uma nova, do zero
+        void Pop(bool discard = false);
+
+        // Aplica as trocas agendadas cujas cenas estao prontas; true se o topo mudou
+        bool ApplyPending();
+        // Espera todas as construcoes em andamento
+        void WaitPending();
+        // Sai de todas as cenas e destroi o cache
+        void Clear();
+
+        Scene* GetActive();
+        void Update(float dt);
+        bool NeedsRedraw();
+        void CollectDamage(DamageTracker& damage);
+        void Render(SDL_Renderer* renderer, float alpha, const std::vector<SDL_Rect>* regions = nullptr);
+};
@@ -0,0 +1,158 @@
+#include "SpatialHash.hpp"
+#include <algorithm>
+
+SpatialHash::SpatialHash(int cellSize)
+    : cellSize(cellSize > 0 ? cellSize : 128) {
+}
+
+// Divisao arredondando para baixo, para coordenadas negativas cairem na celula certa
+int SpatialHash::CellOf(int coord) const {
+    return coord >= 0 ? coord / cellSize : -((-coord + cellSize - 1) / cellSize);
+}
+
+void SpatialHash::CellRange(const SDL_Rect& rect, int& minX, int& minY, int& maxX, int& maxY) const {
+    minX = CellOf(rect.x);
+    minY = CellOf(rect.y);
+    maxX = CellOf(rect.x + std::max(rect.w, 1) - 1);
+    maxY = CellOf(rect.y + std::max(rect.h, 1) - 1);
+}
+
+void SpatialHash::Link(uint32_t id, const Item& item) {
+    for (int cy = item.minY; cy <= item.maxY; cy++) {
+        for (int cx = item.minX; cx <= item.maxX; cx++) {
+            cells[CellKey(cx, cy)].push_back(id);
+        }
+    }
+}
+
+void SpatialHash::Unlink(uint32_t id, const Item& item) {
+    for (int cy = item.minY; cy <= item.maxY; cy++) {
+        for (int cx = item.minX; cx <= item.maxX; cx++) {
+            auto cell = cells.find(CellKey(cx, cy));
+            if (cell == cells.end()) continue;
+
+            std::vector<uint32_t>& ids = cell->second;
+            auto it = std::find(ids.begin(), ids.end(), id);
+            if (it != ids.end()) {
+                *it = ids.back();
+                ids.pop_back();
+            }
+            if (ids.empty()) {
+                cells.erase(cell);
+            }
+        }
+    }
+}
+
+bool SpatialHash::Above(const Item& a, const Item& b) const {
+    if (a.z != b.z) return a.z > b.z;
+    return a.order > b.order;
+}
+
+void SpatialHash::Insert(uint32_t id, const SDL_Rect& rect, int z, uint64_t order) {
+    Remove(id);
+
+    Item item;
+    item.rect = rect;
+    item.z = z;
+    item.order = order;
+    CellRange(rect, item.minX, item.minY, item.maxX, item.maxY);
+
+    Link(id, item);
+    items[id] = item;
+}
+
+void SpatialHash::Update(uint32_t id, const SDL_Rect& rect) {
+    auto it = items.find(id);
+    if (it == items.end()) return;
+
+    Item& item = it->second;
+    item.rect = rect;
+
+    int minX, minY, maxX, maxY;
+    CellRange(rect, minX, minY, maxX, maxY);
+    if (minX == item.minX && minY == item.minY && maxX == item.maxX && maxY == item.maxY) return;
+
+    Unlink(id, item);
+    item.minX = minX;
+    item.minY = minY;
+    item.maxX = maxX;
+    item.maxY = maxY;
+    Link(id, item);
+}
+
+void SpatialHash::Remove(uint32_t id) {
+    auto it = items.find(id);
+    if (it == items.end()) return;
+
+    Unlink(id, it->second);
+    items.erase(it);
+}
+
+void SpatialHash::SetOrder(uint32_t id, uint64_t order) {
+    auto it = items.find(id);
+    if (it != items.end()) {
+        it->second.order = order;
+    }
+}
+
+void SpatialHash::Clear() {
+    items.clear();
+    cells.clear();
+}
+
+bool SpatialHash::GetRect(uint32_t id, SDL_Rect& out) const {
+    auto it = items.find(id);
+    if (it == items.end()) return false;
+
+    out = it->second.rect;
+    return true;
+}
+
+uint32_t SpatialHash::QueryPoint(int x, int y) const {
+    auto cell = cells.find(CellKey(CellOf(x), CellOf(y)));
+    if (cell == cells.end()) return InvalidId;
+
+    uint32_t best = InvalidId;
+    const Item* bestItem = nullptr;
+
+    for (uint32_t id : cell->second) {
+        const Item& item = items.at(id);
+        const SDL_Rect& r = item.rect;
+        if (x < r.x || x >= r.x + r.w || y < r.y || y >= r.y + r.h) continue;
+
+        if (!bestItem || Above(item, *bestItem)) {
+            best = id;
+            bestItem = &item;
+        }
+    }
+    return best;
+}
+
+void SpatialHash::QueryRect(const SDL_Rect& rect, std::vector<uint32_t>& out) const {
+    out.clear();
+
+    int minX, minY, maxX, maxY;
+    CellRange(rect, minX, minY, maxX, maxY);
+
+    for (int cy = minY; cy <= maxY; cy++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            auto cell = cells.find(CellKey(cx, cy));
+            if (cell == cells.end()) continue;
+
+            for (uint32_t id : cell->second) {
+                if (SDL_HasIntersection(&items.at(id).rect, &rect)) {
+                    out.push_back(id);
+                }
+            }
+        }
+    }
+
+    // Itens que cobrem varias celulas aparecem repetidos
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+
+    std::sort(out.begin(), out.end(), [this](uint32_t a, uint32_t b) {
+        return Above(items.at(a), items.at(b));
+    });
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <SDL2/SDL.h>
+
+/*
+    Grade uniforme sobre retangulos, para hit-testing do mouse. Cada item fica
+    registrado em todas as celulas que o retangulo toca; uma consulta por ponto
+    so olha uma celula. A ordem de desenho e dada por (z, ordem), ambos do
+    chamador: z maior fica por cima e, no mesmo z, a ordem maior.
+*/
+class SpatialHash {
+    private:
+        struct Item {
+            SDL_Rect rect;
+            int z;
+            uint64_t order;
+            int minX, minY, maxX, maxY;     // celulas cobertas (inclusivo)
+        };
+
+        int cellSize;
+        std::unordered_map<uint32_t, Item> items;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+
+        static uint64_t CellKey(int cx, int cy) { return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cy; }
+        int CellOf(int coord) const;
+        void CellRange(const SDL_Rect& rect, int& minX, int& minY, int& maxX, int& maxY) const;
+        void Link(uint32_t id, const Item& item);
+        void Unlink(uint32_t id, const Item& item);
+        bool Above(const Item& a, const Item& b) const;
+    public:
+        static constexpr uint32_t InvalidId = UINT32_MAX;
+
+        SpatialHash(int cellSize = 128);
+
+        void Insert(uint32_t id, const SDL_Rect& rect, int z, uint64_t order);
+        // So troca de celulas se o retangulo passou a cobrir outras
+        void Update(uint32_t id, const SDL_Rect& rect);
+        void Remove(uint32_t id);
+        void SetOrder(uint32_t id, uint64_t order);
+        void Clear();
+
+        bool Contains(uint32_t id) const { return items.count(id) > 0; }
+        size_t Size() const { return items.size(); }
+        // Retangulo registrado para o item; false se ele nao esta no indice
+        bool GetRect(uint32_t id, SDL_Rect& out) const;
+
+        // Item mais acima que contem o ponto, ou InvalidId
+        uint32_t QueryPoint(int x, int y) const;
+        // Itens que intersectam o retangulo, do mais acima para o mais abaixo
+        void QueryRect(const SDL_Rect& rect, std::vector<uint32_t>& out) const;
+};
@@ -0,0 +1,10 @@
+#pragma once
+#include <SDL2/SDL.h>
+
+// Regiao de uma textura (normalmente uma pagina de atlas)
+struct Sprite {
+    SDL_Texture* texture = nullptr;
+    SDL_Rect src = { 0, 0, 0, 0 };
+
+    bool IsValid() const { return texture != nullptr; }
+};
@@ -0,0 +1,324 @@
+#include "TextRenderer.hpp"
+#include <iostream>
+#include <algorithm>
+
+uint32_t DecodeUtf8(const std::string& text, size_t& index) {
+    const unsigned char* s = (const unsigned char*)text.data();
+    const size_t length = text.size();
+    unsigned char c = s[index++];
+
+    if (c < 0x80) return c;
+
+    int extra;
+    uint32_t codepoint;
+    if ((c & 0xE0) == 0xC0) {
+        extra = 1;
+        codepoint = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        extra = 2;
+        codepoint = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        extra = 3;
+        codepoint = c & 0x07;
+    } else {
+        return 0xFFFD;
+    }
+
+    for (int i = 0; i < extra; i++) {
+        if (index >= length || (s[index] & 0xC0) != 0x80) return 0xFFFD;
+        codepoint = (codepoint << 6) | (s[index++] & 0x3F);
+    }
+    return codepoint;
+}
+
+FontCache::FontCache(TTF_Font* font, SDL_Renderer* renderer, std::shared_ptr<const std::vector<uint8_t>> data)
+    : font(font), data(std::move(data)), renderer(renderer) {
+    lineHeight = TTF_FontLineSkip(font);
+    ascent = TTF_FontAscent(font);
+    generation = 0;
+    asciiLoaded.fill(false);
+}
+
+FontCache::~FontCache() {
+    Clear();
+    TTF_CloseFont(font);
+}
+
+void FontCache::Clear() {
+    for (auto page : pages) {
+        SDL_DestroyTexture(page);
+    }
+    pages.clear();
+    packers.clear();
+    asciiLoaded.fill(false);
+    others.clear();
+    generation++;
+}
+
+bool FontCache::Upload(SDL_Surface* surface, Glyph& glyph) {
+    SDL_Point position;
+    int w = surface->w + 1;
+    int h = surface->h + 1;
+
+    int page = -1;
+    for (size_t p = 0; p < packers.size(); p++) {
+        if (packers[p].Pack(w, h, position)) {
+            page = (int)p;
+            break;
+        }
+    }
+
+    if (page < 0) {
+        SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, PageSize, PageSize);
+        if (!texture) return false;
+
+        // Pagina nova comeca transparente
+        std::vector<Uint32> clear(PageSize * PageSize, 0);
+        SDL_UpdateTexture(texture, nullptr, clear.data(), PageSize * 4);
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+        pages.push_back(texture);
+        packers.emplace_back(PageSize, PageSize);
+        page = (int)pages.size() - 1;
+
+        if (!packers.back().Pack(w, h, position)) return false;
+    }
+
+    SDL_Rect rect = { position.x, position.y, surface->w, surface->h };
+    SDL_UpdateTexture(pages[page], &rect, surface->pixels, surface->pitch);
+
+    glyph.page = page;
+    glyph.src = rect;
+    return true;
+}
+
+Glyph FontCache::Rasterize(uint32_t codepoint) {
+    Glyph glyph = { -1, { 0, 0, 0, 0 }, 0 };
+
+    int advance = 0;
+    if (TTF_GlyphMetrics32(font, codepoint, nullptr, nullptr, nullptr, nullptr, &advance) == 0) {
+        glyph.advance = advance;
+    }
+
+    if (!renderer || codepoint == ' ') return glyph;
+
+    SDL_Surface* rendered = TTF_RenderGlyph32_Blended(font, codepoint, { 255, 255, 255, 255 });
+    if (!rendered) return glyph;
+
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(rendered);
+    if (!converted) return glyph;
+
+    if (converted->w > 0 && converted->h > 0 && !Upload(converted, glyph)) {
+        glyph.page = -1;
+    }
+
+    SDL_FreeSurface(converted);
+    return glyph;
+}
+
+const Glyph& FontCache::GetGlyph(uint32_t codepoint) {
+    if (codepoint < AsciiCount) {
+        if (!asciiLoaded[codepoint]) {
+            ascii[codepoint] = Rasterize(codepoint);
+            asciiLoaded[codepoint] = true;
+        }
+        return ascii[codepoint];
+    }
+
+    auto it = others.find(codepoint);
+    if (it != others.end()) return it->second;
+
+    return others.emplace(codepoint, Rasterize(codepoint)).first->second;
+}
+
+TextLayout& FontCache::GetLayout(std::string_view text, int maxWidth) {
+    layoutKey.assign(text);
+    layoutKey.append((const char*)&maxWidth, sizeof(maxWidth));
+
+    auto it = layouts.find(layoutKey);
+    if (it != layouts.end()) return *it->second;
+
+    // Textos vindos de dados recarregados nao crescem o cache para sempre
+    if (layouts.size() >= MaxLayouts) layouts.clear();
+
+    auto layout = std::make_unique<TextLayout>();
+    layout->Set(this, text, maxWidth);
+    return *layouts.emplace(layoutKey, std::move(layout)).first->second;
+}
+
+int FontCache::GetKerning(uint32_t previous, uint32_t codepoint) {
+    if (previous == 0) return 0;
+    return TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+}
+
+TextLayout::TextLayout() {
+    font = nullptr;
+    maxWidth = 0;
+    fontGeneration = 0;
+    width = 0;
+    height = 0;
+}
+
+void TextLayout::Set(FontCache* font, std::string_view text, int maxWidth) {
+    bool changed = this->font != font
+        || this->maxWidth != maxWidth
+        || this->text != text
+        || (font && fontGeneration != font->GetGeneration());
+
+    if (!changed) return;
+
+    this->font = font;
+    this->text = text;
+    this->maxWidth = maxWidth;
+    Layout();
+}
+
+void TextLayout::Layout() {
+    quads.clear();
+    width = 0;
+    height = 0;
+
+    if (!font) return;
+
+    fontGeneration = font->GetGeneration();
+
+    const int lineHeight = font->GetLineHeight();
+    int penX = 0;
+    int penY = 0;
+    uint32_t previous = 0;
+
+    // Inicio da palavra atual, para quebrar a linha movendo a palavra inteira
+    size_t wordStartQuad = 0;
+    int wordStartX = 0;
+
+    size_t i = 0;
+    while (i < text.size()) {
+        uint32_t codepoint = DecodeUtf8(text, i);
+
+        if (codepoint == '\n') {
+            penX = 0;
+            penY += lineHeight;
+            previous = 0;
+            wordStartQuad = quads.size();
+            wordStartX = 0;
+            continue;
+        }
+
+        const Glyph& glyph = font->GetGlyph(codepoint);
+        penX += font->GetKerning(previous, codepoint);
+
+        if (codepoint == ' ') {
+            penX += glyph.advance;
+            previous = codepoint;
+            wordStartQuad = quads.size();
+            wordStartX = penX;
+            continue;
+        }
+
+        if (maxWidth > 0 && penX + glyph.advance > maxWidth && wordStartX > 0) {
+            int shift = wordStartX;
+            for (size_t q = wordStartQuad; q < quads.size(); q++) {
+                quads[q].dst.x -= shift;
+                quads[q].dst.y += lineHeight;
+            }
+            penX -= shift;
+            penY += lineHeight;
+            wordStartX = 0;
+        }
+
+        if (glyph.page >= 0) {
+            quads.push_back({
+                font->GetPage(glyph.page),
+                glyph.src,
+                { penX, penY, glyph.src.w, glyph.src.h }
+            });
+        }
+
+        penX += glyph.advance;
+        previous = codepoint;
+    }
+
+    for (const auto& quad : quads) {
+        width = std::max(width, quad.dst.x + quad.dst.w);
+    }
+    height = penY + lineHeight;
+}
+
+void TextLayout::Draw(RenderQueue& queue, int x, int y, SDL_Color color, int16_t layer) {
+    if (font && fontGeneration != font->GetGeneration()) Layout();
+
+    for (const auto& quad : quads) {
+        SDL_Rect dst = { x + quad.dst.x, y + quad.dst.y, quad.dst.w, quad.dst.h };
+        queue.DrawTexture(quad.texture, &quad.src, dst, color, layer);
+    }
+}
+
+void TextLayout::DrawImmediate(SDL_Renderer* renderer, int x, int y, SDL_Color color) {
+    if (font && fontGeneration != font->GetGeneration()) Layout();
+
+    for (const auto& quad : quads) {
+        SDL_Rect dst = { x + quad.dst.x, y + quad.dst.y, quad.dst.w, quad.dst.h };
+        SDL_SetTextureColorMod(quad.texture, color.r, color.g, color.b);
+        SDL_SetTextureAlphaMod(quad.texture, color.a);
+        SDL_RenderCopy(renderer, quad.texture, &quad.src, &dst);
+    }
+}
+
+TextRenderer::TextRenderer() {
+    renderer = nullptr;
+}
+
+TextRenderer::~TextRenderer() {
+    Clear();
+}
+
+void TextRenderer::Clear() {
+    for (auto& [key, font] : fonts) {
+        delete font;
+    }
+    fonts.clear();
+}
+
+void TextRenderer::SetRenderer(SDL_Renderer* renderer) {
+    if (this->renderer == renderer) return;
+
+    Clear();
+    this->renderer = renderer;
+}
+
+FontCache* TextRenderer::GetFont(const std::string& path, int size) {
+    auto key = std::make_pair(path, size);
+    auto it = fonts.find(key);
+    if (it != fonts.end()) return it->second;
+
+    TTF_Font* font = TTF_OpenFont(path.c_str(), size);
+    if (!font) {
+        std::cerr << "Erro ao abrir fonte " << path << ": " << TTF_GetError() << std::endl;
+        fonts[key] = nullptr; // nao tenta abrir de novo
+        return nullptr;
+    }
+
+    FontCache* cache = new FontCache(font, renderer);
+    fonts[key] = cache;
+    return cache;
+}
+
+FontCache* TextRenderer::GetFont(const std::string& name, int size, std::shared_ptr<const std::vector<uint8_t>> data) {
+    auto key = std::make_pair(name, size);
+    auto it = fonts.find(key);
+    if (it != fonts.end() && it->second) return it->second;
+
+    if (!data || data->empty()) return nullptr;
+
+    SDL_RWops* rw = SDL_RWFromConstMem(data->data(), (int)data->size());
+    TTF_Font* font = rw ? TTF_OpenFontRW(rw, 1, size) : nullptr;
+    if (!font) {
+        std::cerr << "Erro ao abrir fonte " << name << ": " << TTF_GetError() << std::endl;
+        return nullptr;
+    }
+
+    FontCache* cache = new FontCache(font, renderer, std::move(data));
+    fonts[key] = cache;
+    return cache;
+}
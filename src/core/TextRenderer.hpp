@@ -0,0 +1,126 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <string_view>
+#include <map>
+#include <memory>
+#include <array>
+#include <unordered_map>
+#include <cstdint>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include "TextureAtlas.hpp"
+#include "RenderQueue.hpp"
+
+class TextLayout;
+
+struct Glyph {
+    int page;           // -1: glyph sem imagem (ex.: espaco)
+    SDL_Rect src;
+    int advance;
+};
+
+/*
+    Cache de glyphs de uma fonte/tamanho: cada glyph e rasterizado uma unica vez
+    (TTF_RenderGlyph32_Blended, em branco) e empacotado em paginas de textura.
+    A cor do texto vem da cor dos vertices na RenderQueue.
+    Textos que se repetem sem dono fixo (ex.: nomes nas faces de carta desenhadas
+    sem o cache de faces) pegam um layout pronto em GetLayout.
+*/
+class FontCache {
+    private:
+        static constexpr int PageSize = 512;
+        static constexpr int AsciiCount = 128;
+        static constexpr size_t MaxLayouts = 256;
+
+        TTF_Font* font;
+        // Bytes do arquivo quando a fonte foi aberta da memoria (precisam viver tanto quanto ela)
+        std::shared_ptr<const std::vector<uint8_t>> data;
+        SDL_Renderer* renderer;
+        int lineHeight;
+        int ascent;
+        uint32_t generation;    // muda quando as paginas sao descartadas
+
+        std::vector<SDL_Texture*> pages;
+        std::vector<SkylinePacker> packers;
+        std::array<Glyph, AsciiCount> ascii;
+        std::array<bool, AsciiCount> asciiLoaded;
+        std::unordered_map<uint32_t, Glyph> others;
+
+        // Chave: texto + largura maxima; o buffer da chave e reaproveitado entre as buscas
+        std::unordered_map<std::string, std::unique_ptr<TextLayout>> layouts;
+        std::string layoutKey;
+
+        Glyph Rasterize(uint32_t codepoint);
+        bool Upload(SDL_Surface* surface, Glyph& glyph);
+    public:
+        FontCache(TTF_Font* font, SDL_Renderer* renderer, std::shared_ptr<const std::vector<uint8_t>> data = nullptr);
+        ~FontCache();
+
+        FontCache(const FontCache&) = delete;
+        FontCache& operator=(const FontCache&) = delete;
+
+        const Glyph& GetGlyph(uint32_t codepoint);
+        int GetKerning(uint32_t previous, uint32_t codepoint);
+        // Valido ate a proxima chamada que crie um layout novo
+        TextLayout& GetLayout(std::string_view text, int maxWidth = 0);
+        SDL_Texture* GetPage(int page) const { return pages[page]; }
+        int GetLineHeight() const { return lineHeight; }
+        int GetAscent() const { return ascent; }
+        uint32_t GetGeneration() const { return generation; }
+        void Clear();
+};
+
+struct TextQuad {
+    SDL_Texture* texture;
+    SDL_Rect src;
+    SDL_Rect dst;       // relativo a origem do texto
+};
+
+/*
+    Resultado da disposicao de uma string UTF-8: quads prontos para desenhar.
+    So e recalculado quando o texto, a fonte ou a largura maxima mudam.
+*/
+class TextLayout {
+    private:
+        FontCache* font;
+        std::string text;
+        int maxWidth;
+        uint32_t fontGeneration;
+
+        std::vector<TextQuad> quads;
+        int width, height;
+
+        void Layout();
+    public:
+        TextLayout();
+
+        // maxWidth > 0 quebra linhas nos espacos
+        void Set(FontCache* font, std::string_view text, int maxWidth = 0);
+        const std::string& GetText() const { return text; }
+        int GetWidth() const { return width; }
+        int GetHeight() const { return height; }
+
+        void Draw(RenderQueue& queue, int x, int y, SDL_Color color, int16_t layer = LAYER_UI);
+        void DrawImmediate(SDL_Renderer* renderer, int x, int y, SDL_Color color);
+};
+
+// Fontes abertas por caminho e tamanho; cada uma com o seu cache de glyphs
+class TextRenderer {
+    private:
+        SDL_Renderer* renderer;
+        std::map<std::pair<std::string, int>, FontCache*> fonts;
+    public:
+        TextRenderer();
+        ~TextRenderer();
+
+        void SetRenderer(SDL_Renderer* renderer);
+        // nullptr se a fonte nao puder ser aberta
+        FontCache* GetFont(const std::string& path, int size);
+        // Abre a partir de bytes ja lidos (ex.: pelo AssetManager); 'name' identifica a fonte no cache
+        FontCache* GetFont(const std::string& name, int size, std::shared_ptr<const std::vector<uint8_t>> data);
+        void Clear();
+};
+
+// Decodifica o proximo codepoint UTF-8 a partir de 'index' (sequencias invalidas viram U+FFFD)
+uint32_t DecodeUtf8(const std::string& text, size_t& index);
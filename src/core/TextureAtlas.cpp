@@ -0,0 +1,270 @@
+#include "TextureAtlas.hpp"
+#include "PackArchive.hpp"
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <climits>
+
+SkylinePacker::SkylinePacker(int width, int height)
+    : width(width), height(height) {
+    Reset();
+}
+
+void SkylinePacker::Reset() {
+    skyline.clear();
+    skyline.push_back({ 0, 0, width });
+}
+
+// Retorna a altura em que o retangulo cabe a partir do no 'index', ou -1
+int SkylinePacker::Fit(size_t index, int w, int h) const {
+    int x = skyline[index].x;
+    if (x + w > width) return -1;
+
+    int y = 0;
+    int remaining = w;
+    for (size_t i = index; remaining > 0; i++) {
+        if (i >= skyline.size()) return -1;
+        y = std::max(y, skyline[i].y);
+        if (y + h > height) return -1;
+        remaining -= skyline[i].width;
+    }
+    return y;
+}
+
+bool SkylinePacker::Pack(int w, int h, SDL_Point& out) {
+    int bestIndex = -1;
+    int bestTop = INT_MAX;
+    int bestWidth = INT_MAX;
+
+    for (size_t i = 0; i < skyline.size(); i++) {
+        int y = Fit(i, w, h);
+        if (y < 0) continue;
+
+        int top = y + h;
+        if (top < bestTop || (top == bestTop && skyline[i].width < bestWidth)) {
+            bestIndex = (int)i;
+            bestTop = top;
+            bestWidth = skyline[i].width;
+        }
+    }
+
+    if (bestIndex < 0) return false;
+
+    Node node = { skyline[bestIndex].x, bestTop, w };
+    out = { node.x, bestTop - h };
+    skyline.insert(skyline.begin() + bestIndex, node);
+
+    // Encolhe ou remove os nos cobertos pelo novo
+    for (size_t i = bestIndex + 1; i < skyline.size(); ) {
+        int nodeEnd = node.x + node.width;
+        if (skyline[i].x >= nodeEnd) break;
+
+        int shrink = nodeEnd - skyline[i].x;
+        skyline[i].x += shrink;
+        skyline[i].width -= shrink;
+
+        if (skyline[i].width <= 0) {
+            skyline.erase(skyline.begin() + i);
+        } else {
+            break;
+        }
+    }
+
+    Merge();
+    return true;
+}
+
+void SkylinePacker::Merge() {
+    for (size_t i = 0; i + 1 < skyline.size(); ) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        } else {
+            i++;
+        }
+    }
+}
+
+TextureAtlas::~TextureAtlas() {
+    Clear();
+}
+
+void TextureAtlas::Clear() {
+    for (auto page : pages) {
+        SDL_DestroyTexture(page);
+    }
+    pages.clear();
+    sprites.clear();
+}
+
+Sprite TextureAtlas::Get(const std::string& name) const {
+    auto it = sprites.find(name);
+    if (it == sprites.end()) return Sprite {};
+    return it->second;
+}
+
+TextureAtlasBuilder::TextureAtlasBuilder(int pageSize, int padding)
+    : pageSize(pageSize), padding(padding) {
+}
+
+TextureAtlasBuilder::~TextureAtlasBuilder() {
+    FreeEntries();
+    FreePages();
+}
+
+void TextureAtlasBuilder::FreeEntries() {
+    for (auto& entry : entries) {
+        SDL_FreeSurface(entry.surface);
+    }
+    entries.clear();
+}
+
+void TextureAtlasBuilder::FreePages() {
+    for (auto page : pageSurfaces) {
+        SDL_FreeSurface(page);
+    }
+    pageSurfaces.clear();
+    packed.clear();
+}
+
+void TextureAtlasBuilder::Add(const std::string& name, SDL_Surface* surface) {
+    if (!surface) return;
+    entries.push_back({ name, surface });
+}
+
+bool TextureAtlasBuilder::AddFile(const std::string& name, const std::string& path) {
+    SDL_Surface* surface = IMG_Load(path.c_str());
+    if (!surface) {
+        std::cerr << "Erro ao carregar imagem " << path << ": " << IMG_GetError() << std::endl;
+        return false;
+    }
+
+    Add(name, surface);
+    return true;
+}
+
+int TextureAtlasBuilder::AddDirectory(const std::string& directory) {
+    namespace fs = std::filesystem;
+
+    std::error_code error;
+    if (!fs::is_directory(directory, error)) return 0;
+
+    int count = 0;
+    for (const auto& file : fs::recursive_directory_iterator(directory, error)) {
+        if (!file.is_regular_file() || file.path().extension() != ".png") continue;
+
+        std::string name = fs::relative(file.path(), directory).replace_extension().generic_string();
+        if (AddFile(name, file.path().string())) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int TextureAtlasBuilder::AddPack(const PackArchive& pack, const std::string& directory) {
+    const std::string prefix = directory + "/";
+    const std::string extension = ".png";
+
+    int count = 0;
+    for (uint32_t i = 0; i < pack.GetEntryCount(); i++) {
+        const PackEntry& entry = pack.GetEntry(i);
+        std::string_view path = pack.GetName(entry);
+        if (!path.starts_with(prefix) || !path.ends_with(extension)) continue;
+
+        SDL_Surface* surface = IMG_Load_RW(pack.OpenRW(entry), 1);
+        if (!surface) {
+            std::cerr << "Erro ao carregar imagem " << path << ": " << IMG_GetError() << std::endl;
+            continue;
+        }
+
+        std::string_view name = path.substr(prefix.size(), path.size() - prefix.size() - extension.size());
+        Add(std::string(name), surface);
+        count++;
+    }
+    return count;
+}
+
+bool TextureAtlasBuilder::Pack() {
+    FreePages();
+
+    // Maiores primeiro: empacota melhor
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.surface->h != b.surface->h) return a.surface->h > b.surface->h;
+        return a.surface->w > b.surface->w;
+    });
+
+    std::vector<SkylinePacker> packers;
+
+    for (auto& entry : entries) {
+        int w = entry.surface->w + padding;
+        int h = entry.surface->h + padding;
+
+        if (w > pageSize || h > pageSize) {
+            std::cerr << "Imagem " << entry.name << " maior que a pagina do atlas" << std::endl;
+            continue;
+        }
+
+        SDL_Point position;
+        int page = -1;
+        for (size_t p = 0; p < packers.size(); p++) {
+            if (packers[p].Pack(w, h, position)) {
+                page = (int)p;
+                break;
+            }
+        }
+
+        if (page < 0) {
+            SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, pageSize, pageSize, 32, SDL_PIXELFORMAT_RGBA32);
+            if (!surface) {
+                FreeEntries();
+                return false;
+            }
+
+            pageSurfaces.push_back(surface);
+            packers.emplace_back(pageSize, pageSize);
+            page = (int)packers.size() - 1;
+            packers.back().Pack(w, h, position);
+        }
+
+        SDL_Rect dst = { position.x, position.y, entry.surface->w, entry.surface->h };
+        // Copia os pixels (inclusive alpha) sem misturar
+        SDL_SetSurfaceBlendMode(entry.surface, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(entry.surface, nullptr, pageSurfaces[page], &dst);
+
+        packed.push_back({ entry.name, page, dst });
+    }
+
+    FreeEntries();
+    return true;
+}
+
+bool TextureAtlasBuilder::Upload(SDL_Renderer* renderer, TextureAtlas& atlas) {
+    atlas.Clear();
+
+    bool ok = true;
+    for (auto page : pageSurfaces) {
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, page);
+        if (!texture) {
+            std::cerr << "Erro ao criar pagina do atlas: " << SDL_GetError() << std::endl;
+            ok = false;
+            break;
+        }
+
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        atlas.pages.push_back(texture);
+    }
+
+    for (const auto& sprite : packed) {
+        if (sprite.page < (int)atlas.pages.size()) {
+            atlas.sprites[sprite.name] = Sprite { atlas.pages[sprite.page], sprite.rect };
+        }
+    }
+
+    FreePages();
+    return ok;
+}
+
+bool TextureAtlasBuilder::Build(SDL_Renderer* renderer, TextureAtlas& atlas) {
+    return Pack() && Upload(renderer, atlas);
+}
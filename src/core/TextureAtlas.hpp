@@ -0,0 +1,97 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <SDL2/SDL.h>
+#include "Sprite.hpp"
+
+class PackArchive;
+
+/*
+    Empacotador skyline (bottom-left): mantem o contorno superior da area ocupada
+    e coloca cada retangulo onde seu topo fica mais baixo.
+*/
+class SkylinePacker {
+    private:
+        struct Node {
+            int x, y, width;
+        };
+
+        int width, height;
+        std::vector<Node> skyline;
+
+        int Fit(size_t index, int w, int h) const;
+        void Merge();
+    public:
+        SkylinePacker(int width, int height);
+
+        void Reset();
+        bool Pack(int w, int h, SDL_Point& out);
+};
+
+class TextureAtlas {
+    private:
+        std::vector<SDL_Texture*> pages;
+        std::unordered_map<std::string, Sprite> sprites;
+
+        friend class TextureAtlasBuilder;
+    public:
+        TextureAtlas() {}
+        ~TextureAtlas();
+
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        void Clear();
+        // Sprite invalido se o nome nao existir
+        Sprite Get(const std::string& name) const;
+        bool Has(const std::string& name) const { return sprites.count(name) != 0; }
+        size_t GetPageCount() const { return pages.size(); }
+        size_t GetSpriteCount() const { return sprites.size(); }
+};
+
+/*
+    Coleta imagens (SDL2_image) e as empacota em poucas texturas grandes no carregamento.
+    Sprites da mesma pagina sao desenhados em um unico lote pela RenderQueue.
+*/
+class TextureAtlasBuilder {
+    private:
+        struct Entry {
+            std::string name;
+            SDL_Surface* surface;
+        };
+
+        struct PackedSprite {
+            std::string name;
+            int page;
+            SDL_Rect rect;
+        };
+
+        int pageSize;
+        int padding;
+        std::vector<Entry> entries;
+        // Resultado do Pack(), aguardando o Upload()
+        std::vector<SDL_Surface*> pageSurfaces;
+        std::vector<PackedSprite> packed;
+
+        void FreeEntries();
+        void FreePages();
+    public:
+        TextureAtlasBuilder(int pageSize = 2048, int padding = 1);
+        ~TextureAtlasBuilder();
+
+        // Assume a posse da superficie
+        void Add(const std::string& name, SDL_Surface* surface);
+        bool AddFile(const std::string& name, const std::string& path);
+        // Adiciona todas as imagens .png do diretorio (recursivo); o nome e o caminho relativo sem extensao
+        int AddDirectory(const std::string& directory);
+        // Mesmo que AddDirectory, mas lendo as imagens de um pacote
+        int AddPack(const PackArchive& pack, const std::string& directory);
+
+        // Empacota as imagens em superficies de pagina; so usa CPU, pode rodar em outra thread
+        bool Pack();
+        // Cria as texturas das paginas; deve rodar na thread do renderer
+        bool Upload(SDL_Renderer* renderer, TextureAtlas& atlas);
+        // Pack() + Upload()
+        bool Build(SDL_Renderer* renderer, TextureAtlas& atlas);
+};
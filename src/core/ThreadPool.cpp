@@ -0,0 +1,68 @@
+#include "ThreadPool.hpp"
+
+ThreadPool::ThreadPool(unsigned threads) {
+    running = 0;
+    stopping = false;
+
+    if (threads == 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        threads = (cores > 1) ? cores - 1 : 1;
+    }
+
+    workers.reserve(threads);
+    for (unsigned i = 0; i < threads; i++) {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::Submit(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+    }
+    jobAvailable.notify_one();
+}
+
+void ThreadPool::WaitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return jobs.empty() && running == 0; });
+}
+
+void ThreadPool::WorkerLoop() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobAvailable.wait(lock, [this] { return stopping || !jobs.empty(); });
+
+            // Termina as tarefas pendentes antes de sair
+            if (jobs.empty()) return;
+
+            job = std::move(jobs.front());
+            jobs.pop_front();
+            running++;
+        }
+
+        job();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running--;
+            if (jobs.empty() && running == 0) {
+                idle.notify_all();
+            }
+        }
+    }
+}
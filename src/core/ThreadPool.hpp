@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+// Pool fixo de threads de trabalho com uma fila FIFO de tarefas
+class ThreadPool {
+    private:
+        std::vector<std::thread> workers;
+        std::deque<std::function<void()>> jobs;
+        std::mutex mutex;
+        std::condition_variable jobAvailable;
+        std::condition_variable idle;
+        unsigned running;
+        bool stopping;
+
+        void WorkerLoop();
+    public:
+        // threads == 0: uma por nucleo, menos a thread principal (minimo 1)
+        ThreadPool(unsigned threads = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void Submit(std::function<void()> job);
+        // Bloqueia ate a fila esvaziar e todas as tarefas terminarem
+        void WaitIdle();
+        unsigned GetThreadCount() const { return (unsigned)workers.size(); }
+};
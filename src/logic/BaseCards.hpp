@@ -0,0 +1,28 @@
+#pragma once
+#include <array>
+#include <string_view>
+#include "CardTable.hpp"
+
+/*
+    Conjunto base. Os ids sao a posicao na tabela e ficam salvos nos saves:
+    cartas novas entram no fim, nunca no meio.
+*/
+inline constexpr std::array BaseCards = {
+    Creature(0, "Guerreiro", 3, 3, 4),
+    Creature(1, "Escudeiro", 1, 1, 2, { EffectType::ARMOR, 2 }),
+    Spell(2, "Bola de Fogo", 5, { EffectType::DAMAGE, 6 }),
+    Spell(3, "Cura", 2, { EffectType::HEAL, 5 }, { EffectType::DRAW, 1 }),
+    Creature(4, "Lobo", 2, 2, 2),
+    Spell(5, "Chamado da Matilha", 4, { EffectType::SUMMON, 2, 4 })
+};
+
+static_assert(ValidateCardTable(BaseCards));
+
+inline constexpr CardNameIndex<BaseCards.size()> BaseCardIndex = BuildCardNameIndex(BaseCards);
+
+// Id de uma carta base pelo nome, resolvido na compilacao: um nome errado nao compila
+consteval CardId BaseCardId(std::string_view name) {
+    CardId id = BaseCardIndex.Find(name, BaseCards);
+    if (id == InvalidCard) throw "carta base inexistente";
+    return id;
+}
@@ -0,0 +1,201 @@
+#include "Battle.hpp"
+
+Battle::Battle(const CardDatabase& database, uint64_t seed)
+    : database(&database), board(database), players{ Player(0), Player(0) } {
+    Random random(seed);
+    players[0] = Player(random.Split());
+    players[1] = Player(random.Split());
+    players[1].SetHashSide(1);
+    active = BoardSide::PLAYER;
+    turn = 0;
+}
+
+void Battle::Start(int heroHealth, BoardSide first) {
+    board.Clear();
+    board.SetHero(BoardSide::PLAYER, MakeHero(heroHealth));
+    board.SetHero(BoardSide::ENEMY, MakeHero(heroHealth));
+
+    for (Player& player : players) {
+        player.ClearHand();
+        player.SetMana(0, 0);
+        player.GetDeck().Reshuffle();
+        player.Draw(StartingHand);
+    }
+
+    active = first;
+    turn = 1;
+    players[Index(active)].StartTurn();
+}
+
+int Battle::GetMoves(MoveList& out) const {
+    int count = 0;
+    out[count++] = BattleMove();
+    if (IsOver()) return count;
+
+    const Player& player = players[Index(active)];
+    const Board::Row& own = board.GetRow(active);
+
+    for (int i = 0; i < player.GetHandSize(); i++) {
+        CardId id = player.GetHandCard(i);
+        if (!database->IsValid(id)) continue;
+
+        // Mesma carta mais a esquerda na mao ja gerou estas jogadas
+        bool repeated = false;
+        for (int j = 0; j < i; j++) repeated |= player.GetHandCard(j) == id;
+        if (repeated) continue;
+
+        const CardDefinition& card = database->Get(id);
+        if (card.manaCost > player.GetMana()) continue;
+
+        BattleMove move;
+        move.type = MoveType::PLAY_CARD;
+        move.handIndex = (uint8_t)i;
+
+        if (card.type == CardType::CREATURE) {
+            for (int lane = 0; lane < Board::Lanes; lane++) {
+                if (own.card[lane] != InvalidCard) continue;
+                move.lane = (int8_t)lane;
+                out[count++] = move;
+            }
+        } else if (TargetsLane(card)) {
+            out[count++] = move;
+            for (int lane = 0; lane < Board::Lanes; lane++) {
+                if (!IsValidSpellTarget(card, lane)) continue;
+                move.lane = (int8_t)lane;
+                out[count++] = move;
+            }
+        } else {
+            out[count++] = move;
+        }
+    }
+
+    return count;
+}
+
+bool Battle::Apply(const BattleMove& move) {
+    if (IsOver()) return false;
+
+    if (move.type == MoveType::PLAY_CARD) {
+        return PlayCard(move.handIndex, move.lane);
+    }
+
+    board.ResolveRound();
+    CollectDraws();
+
+    active = Other(active);
+    turn++;
+    players[Index(active)].StartTurn();
+    return true;
+}
+
+bool Battle::PlayCard(int handIndex, int lane) {
+    Player& player = players[Index(active)];
+    CardId id = player.GetHandCard(handIndex);
+    if (!database->IsValid(id)) return false;
+
+    const CardDefinition& card = database->Get(id);
+    if (card.manaCost > player.GetMana()) return false;
+
+    if (card.type == CardType::CREATURE) {
+        CardInstance instance;
+        instance.id = id;
+        if (!board.Place(active, lane, MakeCreature(*database, instance))) return false;
+    } else {
+        // Alvo conferido antes de qualquer mudanca: jogada invalida nao gasta mana nem a carta
+        if (!IsValidSpellTarget(card, lane)) return false;
+        CastSpell(card, lane);
+        player.GetDeck().Discard(id);
+    }
+
+    player.Spend(card.manaCost);
+    player.TakeFromHand(handIndex);
+    CollectDraws();
+    return true;
+}
+
+bool Battle::TargetsLane(const CardDefinition& spell) {
+    for (const CardEffect& effect : spell.effects) {
+        if (effect.type == EffectType::DAMAGE) return true;
+    }
+    return false;
+}
+
+bool Battle::IsValidSpellTarget(const CardDefinition& spell, int lane) const {
+    if (lane == -1) return true;
+    if (lane < 0 || lane >= Board::Lanes || !TargetsLane(spell)) return false;
+    return board.GetRow(Other(active)).card[lane] != InvalidCard;
+}
+
+void Battle::CastSpell(const CardDefinition& spell, int lane) {
+    Player& player = players[Index(active)];
+    BoardSide enemy = Other(active);
+
+    for (const CardEffect& effect : spell.effects) {
+        switch (effect.type) {
+            case EffectType::DAMAGE:
+                if (lane >= 0) {
+                    board.DamageCreature(enemy, lane, effect.amount);
+                } else {
+                    board.DamageHero(enemy, effect.amount);
+                }
+                break;
+            case EffectType::HEAL:
+                board.HealHero(active, effect.amount);
+                break;
+            case EffectType::ARMOR:
+                board.AddHeroArmor(active, effect.amount);
+                break;
+            case EffectType::DRAW:
+                player.Draw(effect.amount);
+                break;
+            case EffectType::SUMMON:
+                board.Summon(active, 0, effect.card, effect.amount);
+                break;
+            case EffectType::NONE:
+                break;
+        }
+    }
+}
+
+void Battle::CollectDraws() {
+    for (BoardSide side : { BoardSide::PLAYER, BoardSide::ENEMY }) {
+        int draws = board.TakeDraws(side);
+        if (draws > 0) players[Index(side)].Draw(draws);
+    }
+}
+
+CombatOutcome Battle::GetOutcome() const {
+    CombatOutcome outcome = board.GetOutcome();
+    if (outcome == CombatOutcome::ONGOING && turn > MaxTurns) return CombatOutcome::DRAW;
+    return outcome;
+}
+
+uint64_t Battle::GetHash() {
+    return board.GetHash() ^ players[0].GetHash() ^ players[1].GetHash() ^
+        ZobristKey(ZobristFeature::TURN, turn, (uint64_t)active);
+}
+
+uint64_t Battle::ComputeHash() const {
+    return board.ComputeHash() ^ players[0].ComputeHash() ^ players[1].ComputeHash() ^
+        ZobristKey(ZobristFeature::TURN, turn, (uint64_t)active);
+}
+
+void Battle::Determinize(BoardSide viewer, Random& random) {
+    Player& hidden = players[Index(Other(viewer))];
+
+    int handSize = hidden.GetHandSize();
+    for (int i = 0; i < handSize; i++) {
+        hidden.GetDeck().Add(hidden.GetHandCard(i));
+    }
+    hidden.ClearHand();
+
+    for (Player& player : players) {
+        player.GetDeck().GetRandom() = random.Split();
+        player.GetDeck().Shuffle();
+    }
+
+    // A mao acabou de voltar para a compra: ha cartas suficientes sem tocar no descarte
+    for (int i = 0; i < handSize; i++) {
+        hidden.AddToHand(hidden.GetDeck().Draw());
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "Board.hpp"
+#include "Player.hpp"
+
+enum class MoveType : uint8_t {
+    END_TURN,
+    PLAY_CARD
+};
+
+struct BattleMove {
+    MoveType type = MoveType::END_TURN;
+    uint8_t handIndex = 0;
+    // Criatura: pista onde entra. Feitico de dano: pista inimiga alvo, ou -1 para o heroi.
+    int8_t lane = -1;
+
+    bool operator==(const BattleMove& other) const = default;
+};
+
+/*
+    Estado completo de uma batalha, sem SDL: tabuleiro, os dois lados e de quem e a vez.
+    Regras:
+        - no seu turno um lado joga cartas da mao enquanto tiver mana
+        - encerrar o turno resolve uma rodada de combate e passa a vez;
+          o outro lado ganha mana e compra uma carta
+        - feiticos vao para o descarte; criaturas saem do baralho ao entrar em campo
+    Tudo tem capacidade fixa: copiar um Battle e tirar um snapshot, o que a busca
+    do Opponent faz milhares de vezes por jogada. GetHash identifica a posicao
+    (tabuleiro, maos, mana, turno e vez) para a TranspositionTable.
+*/
+class Battle {
+    public:
+        static constexpr int StartingHand = 3;
+        // Acima disso a batalha termina empatada
+        static constexpr int MaxTurns = 60;
+        static constexpr int MaxMoves = Player::MaxHandSize * (Board::Lanes + 1) + 1;
+
+        using MoveList = std::array<BattleMove, MaxMoves>;
+    private:
+        const CardDatabase* database;
+        Board board;
+        std::array<Player, 2> players;
+        BoardSide active;
+        uint16_t turn;
+
+        static int Index(BoardSide side) { return (int)side; }
+        static BoardSide Other(BoardSide side) { return side == BoardSide::PLAYER ? BoardSide::ENEMY : BoardSide::PLAYER; }
+
+        bool PlayCard(int handIndex, int lane);
+        // Feitico com algum efeito de DAMAGE: aceita uma pista inimiga como alvo
+        static bool TargetsLane(const CardDefinition& spell);
+        // -1 (heroi ou sem alvo) sempre vale; uma pista so se o feitico mira e ha inimigo nela
+        bool IsValidSpellTarget(const CardDefinition& spell, int lane) const;
+        void CastSpell(const CardDefinition& spell, int lane);
+        // Compras pedidas por efeitos de morte no tabuleiro
+        void CollectDraws();
+    public:
+        // Cada baralho recebe um gerador proprio, derivado da semente
+        Battle(const CardDatabase& database, uint64_t seed);
+
+        // Embaralha os baralhos (montados antes via GetPlayer), define os herois e compra as maos
+        void Start(int heroHealth, BoardSide first = BoardSide::PLAYER);
+
+        // Jogadas validas do lado da vez; cartas repetidas na mao geram as jogadas uma vez so
+        int GetMoves(MoveList& out) const;
+        // false se a jogada nao e valida (nada muda)
+        bool Apply(const BattleMove& move);
+        CombatOutcome GetOutcome() const;
+        bool IsOver() const { return GetOutcome() != CombatOutcome::ONGOING; }
+
+        /*
+            Troca o que 'viewer' nao ve por uma amostra coerente com o que ve:
+            a mao do adversario volta ao baralho dele e e recomprada, os dois
+            baralhos sao reembaralhados e os geradores deles sao trocados por
+            derivados de 'random' (senao a busca saberia as compras futuras).
+        */
+        void Determinize(BoardSide viewer, Random& random);
+
+        Board& GetBoard() { return board; }
+        const Board& GetBoard() const { return board; }
+        Player& GetPlayer(BoardSide side) { return players[Index(side)]; }
+        const Player& GetPlayer(BoardSide side) const { return players[Index(side)]; }
+        BoardSide GetActive() const { return active; }
+        int GetTurn() const { return turn; }
+
+        // Composto dos hashes mantidos por Board e Player; nao percorre o estado
+        uint64_t GetHash();
+        uint64_t ComputeHash() const;
+};
+
+static_assert(std::is_trivially_copyable_v<Battle>, "Battle e copiado como snapshot");
@@ -0,0 +1,80 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/*
+    Escrita e leitura de campos com largura em bits, para formatos compactos.
+    Os bits entram em little-endian: o primeiro campo ocupa os bits baixos do
+    primeiro byte. O resultado nao depende da ordem de bytes da maquina.
+*/
+class BitWriter {
+    private:
+        std::vector<uint8_t>& out;
+        uint64_t buffer;
+        int bits;
+    public:
+        explicit BitWriter(std::vector<uint8_t>& out) : out(out), buffer(0), bits(0) {}
+
+        // 'width' de 1 a 32; bits acima de 'width' em 'value' sao ignorados
+        void Write(uint32_t value, int width) {
+            buffer |= (uint64_t)(value & (uint32_t)((1ull << width) - 1)) << bits;
+            bits += width;
+            while (bits >= 8) {
+                out.push_back((uint8_t)buffer);
+                buffer >>= 8;
+                bits -= 8;
+            }
+        }
+
+        void Write64(uint64_t value) {
+            Write((uint32_t)value, 32);
+            Write((uint32_t)(value >> 32), 32);
+        }
+
+        // Completa o byte atual com zeros
+        void Align() {
+            if (bits > 0) Write(0, 8 - bits);
+        }
+};
+
+class BitReader {
+    private:
+        const uint8_t* data;
+        size_t size;
+        size_t position;
+        uint64_t buffer;
+        int bits;
+        bool failed;
+    public:
+        BitReader(const uint8_t* data, size_t size)
+            : data(data), size(size), position(0), buffer(0), bits(0), failed(false) {}
+
+        // Ler alem do fim devolve 0 e marca a falha; confira Failed() no final
+        uint32_t Read(int width) {
+            while (bits < width) {
+                if (position >= size) {
+                    failed = true;
+                    return 0;
+                }
+                buffer |= (uint64_t)data[position++] << bits;
+                bits += 8;
+            }
+            uint32_t value = (uint32_t)(buffer & ((1ull << width) - 1));
+            buffer >>= width;
+            bits -= width;
+            return value;
+        }
+
+        uint64_t Read64() {
+            uint64_t low = Read(32);
+            return low | (uint64_t)Read(32) << 32;
+        }
+
+        // Descarta o resto do byte atual
+        void Align() { Read(bits % 8); }
+
+        // Bytes consumidos ate aqui (apos Align)
+        size_t GetPosition() const { return position - (size_t)(bits / 8); }
+        bool Failed() const { return failed; }
+};
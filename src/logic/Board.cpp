@@ -0,0 +1,363 @@
+#include "Board.hpp"
+#include <algorithm>
+
+static_assert(InvalidCard == (CardId)~0, "DeathSweep esvazia pistas ligando todos os bits do id");
+
+Board::Board(const CardDatabase& database) : database(&database) {
+    Clear();
+}
+
+void Board::Clear() {
+    for (Row& row : rows) {
+        row.health.fill(0);
+        row.attack.fill(0);
+        row.armor.fill(0);
+        row.damage.fill(0);
+        row.card.fill(InvalidCard);
+        row.flags.fill(0);
+        row.deathEffect.fill(CardEffect());
+    }
+
+    heroes.fill(Entity());
+    heroMaxHealth.fill(0);
+    draws.fill(0);
+    deathCount = 0;
+    rounds = 0;
+
+    for (auto& keys : laneKeys) keys.fill(0);
+    heroKeys.fill(0);
+    hash = 0;
+    lanesStale = false;
+    RehashHero(0);
+    RehashHero(1);
+}
+
+uint64_t Board::LaneKey(int side, int lane) const {
+    const Row& row = rows[side];
+    if (row.card[lane] == InvalidCard) return 0;
+
+    const CardEffect& effect = row.deathEffect[lane];
+    uint64_t a = (uint64_t)side | (uint64_t)lane << 8 | (uint64_t)row.card[lane] << 16 |
+        (uint64_t)row.flags[lane] << 32 | (uint64_t)effect.type << 40 | (uint64_t)effect.card << 48;
+    uint64_t b = (uint64_t)(uint16_t)row.health[lane] | (uint64_t)(uint16_t)row.attack[lane] << 16 |
+        (uint64_t)(uint16_t)row.armor[lane] << 32 | (uint64_t)(uint16_t)effect.amount << 48;
+    return ZobristKey(ZobristFeature::LANE, a, b);
+}
+
+uint64_t Board::HeroKey(int side) const {
+    const Entity& hero = heroes[side];
+    uint64_t b = (uint64_t)(uint16_t)hero.health | (uint64_t)(uint16_t)hero.armor << 16 |
+        (uint64_t)(uint16_t)heroMaxHealth[side] << 32;
+    return ZobristKey(ZobristFeature::HERO, (uint64_t)side, b);
+}
+
+void Board::RehashLane(int side, int lane) {
+    uint64_t key = LaneKey(side, lane);
+    hash ^= laneKeys[side][lane] ^ key;
+    laneKeys[side][lane] = key;
+}
+
+uint64_t Board::GetHash() {
+    if (lanesStale) {
+        RehashLanes();
+        lanesStale = false;
+    }
+    return hash;
+}
+
+void Board::RehashLanes() {
+    for (int side = 0; side < 2; side++) {
+        for (int lane = 0; lane < Lanes; lane++) {
+            RehashLane(side, lane);
+        }
+    }
+}
+
+void Board::RehashHero(int side) {
+    uint64_t key = HeroKey(side);
+    hash ^= heroKeys[side] ^ key;
+    heroKeys[side] = key;
+}
+
+uint64_t Board::ComputeHash() const {
+    uint64_t result = HeroKey(0) ^ HeroKey(1);
+    for (int side = 0; side < 2; side++) {
+        for (int lane = 0; lane < Lanes; lane++) {
+            result ^= LaneKey(side, lane);
+        }
+    }
+    return result;
+}
+
+bool Board::Place(BoardSide side, int lane, const Entity& creature) {
+    if (lane < 0 || lane >= Lanes || creature.card == InvalidCard || creature.health <= 0) return false;
+
+    Row& row = rows[Index(side)];
+    if (row.card[lane] != InvalidCard) return false;
+
+    row.health[lane] = creature.health;
+    // Ataque negativo curaria o alvo nos passes
+    row.attack[lane] = std::max<int16_t>(creature.attack, 0);
+    row.armor[lane] = std::max<int16_t>(creature.armor, 0);
+    row.damage[lane] = 0;
+    row.card[lane] = creature.card;
+    row.flags[lane] = creature.flags;
+    row.deathEffect[lane] = creature.deathEffect;
+    RehashLane(Index(side), lane);
+    return true;
+}
+
+void Board::Remove(BoardSide side, int lane) {
+    if (lane < 0 || lane >= Lanes) return;
+
+    Row& row = rows[Index(side)];
+    row.health[lane] = 0;
+    row.attack[lane] = 0;
+    row.armor[lane] = 0;
+    row.damage[lane] = 0;
+    row.card[lane] = InvalidCard;
+    row.flags[lane] = 0;
+    row.deathEffect[lane] = CardEffect();
+    RehashLane(Index(side), lane);
+}
+
+int Board::FirstFreeLane(BoardSide side) const {
+    const Row& row = rows[Index(side)];
+    for (int i = 0; i < Lanes; i++) {
+        if (row.card[i] == InvalidCard) return i;
+    }
+    return -1;
+}
+
+Entity Board::Get(BoardSide side, int lane) const {
+    Entity entity;
+    if (lane < 0 || lane >= Lanes) return entity;
+
+    const Row& row = rows[Index(side)];
+    entity.card = row.card[lane];
+    entity.health = row.health[lane];
+    entity.attack = row.attack[lane];
+    entity.armor = row.armor[lane];
+    entity.flags = row.flags[lane];
+    entity.deathEffect = row.deathEffect[lane];
+    return entity;
+}
+
+int Board::CountCreatures(BoardSide side) const {
+    const Row& row = rows[Index(side)];
+    return (int)std::count_if(row.card.begin(), row.card.end(), [](CardId id) { return id != InvalidCard; });
+}
+
+void Board::SetHero(BoardSide side, const Entity& hero) {
+    heroes[Index(side)] = hero;
+    heroMaxHealth[Index(side)] = hero.health;
+    RehashHero(Index(side));
+}
+
+int Board::TakeDraws(BoardSide side) {
+    int count = draws[Index(side)];
+    draws[Index(side)] = 0;
+    return count;
+}
+
+int Board::AttackPass() {
+    int total = 0;
+
+    for (Row& row : rows) {
+        for (int i = 0; i < Lanes; i++) {
+            // Pista vazia tem ataque 0; congelada multiplica por 0
+            int16_t active = (row.flags[i] & STATUS_FROZEN) == 0;
+            row.damage[i] = (int16_t)(row.attack[i] * active);
+        }
+        for (int i = 0; i < Lanes; i++) {
+            total += row.damage[i];
+        }
+    }
+
+    return total;
+}
+
+int Board::DamagePass() {
+    int ticks = 0;
+
+    for (int side = 0; side < 2; side++) {
+        Row& row = rows[side];
+        // Copia local: sem ela o compilador precisaria provar que as fileiras nao se sobrepoem
+        const std::array<int16_t, Lanes> incoming = rows[1 - side].damage;
+
+        int toHero = 0;
+        for (int i = 0; i < Lanes; i++) {
+            // Mascaras de bits (0 ou todos os bits) no lugar de desvios
+            int16_t occupied = -(int16_t)(row.card[i] != InvalidCard);
+            int16_t hit = incoming[i] & occupied;
+
+            // Escudo anula o golpe inteiro e se gasta
+            int16_t shield = -(int16_t)(((row.flags[i] & STATUS_SHIELDED) != 0) & (hit > 0));
+            hit &= ~shield;
+            row.flags[i] &= (uint8_t)~(shield & STATUS_SHIELDED);
+
+            int16_t absorbed = std::min(row.armor[i], hit);
+            int16_t poison = occupied & ((row.flags[i] & STATUS_POISONED) != 0);
+            row.armor[i] = (int16_t)(row.armor[i] - absorbed);
+            row.health[i] = (int16_t)(row.health[i] - (hit - absorbed) - poison);
+
+            toHero += incoming[i] & ~occupied;
+            ticks += poison;
+        }
+
+        DamageHero((BoardSide)side, toHero);
+    }
+
+    return ticks;
+}
+
+void Board::DamageHero(BoardSide side, int amount) {
+    Entity& hero = heroes[Index(side)];
+    int absorbed = std::min<int>(hero.armor, amount);
+    hero.armor = (int16_t)(hero.armor - absorbed);
+    hero.health = (int16_t)(hero.health - (amount - absorbed));
+    RehashHero(Index(side));
+}
+
+void Board::HealHero(BoardSide side, int amount) {
+    Entity& hero = heroes[Index(side)];
+    hero.health = (int16_t)std::min(hero.health + amount, (int)heroMaxHealth[Index(side)]);
+    RehashHero(Index(side));
+}
+
+void Board::AddHeroArmor(BoardSide side, int amount) {
+    Entity& hero = heroes[Index(side)];
+    hero.armor = (int16_t)(hero.armor + amount);
+    RehashHero(Index(side));
+}
+
+void Board::DamageCreature(BoardSide side, int lane, int amount) {
+    if (lane < 0 || lane >= Lanes || amount <= 0) return;
+
+    Row& row = rows[Index(side)];
+    if (row.card[lane] == InvalidCard) return;
+
+    if (row.flags[lane] & STATUS_SHIELDED) {
+        row.flags[lane] &= (uint8_t)~STATUS_SHIELDED;
+        RehashLane(Index(side), lane);
+        return;
+    }
+
+    int absorbed = std::min<int>(row.armor[lane], amount);
+    row.armor[lane] = (int16_t)(row.armor[lane] - absorbed);
+    row.health[lane] = (int16_t)(row.health[lane] - (amount - absorbed));
+
+    DeathSweep();
+    TriggerPass();
+    lanesStale = true;
+}
+
+void Board::DeathSweep() {
+    deathCount = 0;
+
+    for (int side = 0; side < 2; side++) {
+        Row& row = rows[side];
+
+        // Compactacao sem desvio: escreve sempre, avanca so se morreu
+        for (int i = 0; i < Lanes; i++) {
+            bool dead = row.card[i] != InvalidCard && row.health[i] <= 0;
+            deaths[deathCount] = { (uint8_t)side, (uint8_t)i, row.deathEffect[i] };
+            deathCount += dead;
+            // O efeito ja esta na lista; a pista pode receber uma invocacao
+            row.deathEffect[i] = dead ? CardEffect() : row.deathEffect[i];
+        }
+
+        // Vivo tem vida > 0; pista vazia ja esta zerada e continua assim
+        for (int i = 0; i < Lanes; i++) {
+            int16_t keep = -(int16_t)(row.health[i] > 0);
+            row.health[i] &= keep;
+            row.attack[i] &= keep;
+            row.armor[i] &= keep;
+            row.card[i] |= (CardId)~keep;   // InvalidCard tem todos os bits
+            row.flags[i] &= (uint8_t)keep;
+        }
+    }
+}
+
+int Board::Summon(BoardSide side, int lane, CardId card, int copies) {
+    if (!database->IsValid(card) || lane < 0 || lane >= Lanes) return 0;
+
+    CardInstance instance;
+    instance.id = card;
+    Entity creature = MakeCreature(*database, instance);
+
+    int placed = 0;
+    for (int step = 0; step < Lanes && placed < copies; step++) {
+        placed += Place(side, (lane + step) % Lanes, creature);
+    }
+    return placed;
+}
+
+void Board::TriggerPass() {
+    for (uint32_t i = 0; i < deathCount; i++) {
+        const Death& death = deaths[i];
+        const CardEffect& effect = death.effect;
+        BoardSide side = (BoardSide)death.side;
+
+        switch (effect.type) {
+            case EffectType::DAMAGE:
+                DamageHero((BoardSide)(1 - death.side), effect.amount);
+                break;
+            case EffectType::HEAL:
+                HealHero(side, effect.amount);
+                break;
+            case EffectType::ARMOR:
+                AddHeroArmor(side, effect.amount);
+                break;
+            case EffectType::DRAW:
+                draws[death.side] += effect.amount;
+                break;
+            case EffectType::SUMMON:
+                Summon(side, death.lane, effect.card, effect.amount);
+                break;
+            case EffectType::NONE:
+                break;
+        }
+    }
+    deathCount = 0;
+}
+
+void Board::EndRoundPass() {
+    // Quem estava congelado volta a atacar na proxima rodada
+    for (Row& row : rows) {
+        for (int i = 0; i < Lanes; i++) {
+            row.flags[i] &= (uint8_t)~STATUS_FROZEN;
+        }
+    }
+}
+
+bool Board::ResolveRound() {
+    int dealt = AttackPass();
+    int ticks = DamagePass();
+    DeathSweep();
+    TriggerPass();
+    EndRoundPass();
+    lanesStale = true;
+
+    rounds++;
+    return dealt > 0 || ticks > 0;
+}
+
+int Board::Resolve(int maxRounds) {
+    int played = 0;
+    while (played < maxRounds && !IsOver()) {
+        played++;
+        if (!ResolveRound()) break;
+    }
+    return played;
+}
+
+CombatOutcome Board::GetOutcome() const {
+    bool playerDead = heroes[Index(BoardSide::PLAYER)].health <= 0;
+    bool enemyDead = heroes[Index(BoardSide::ENEMY)].health <= 0;
+
+    if (playerDead && enemyDead) return CombatOutcome::DRAW;
+    if (playerDead) return CombatOutcome::ENEMY_WON;
+    if (enemyDead) return CombatOutcome::PLAYER_WON;
+    return CombatOutcome::ONGOING;
+}
@@ -0,0 +1,133 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "Entity.hpp"
+#include "Zobrist.hpp"
+
+enum class BoardSide : uint8_t {
+    PLAYER,
+    ENEMY
+};
+
+enum class CombatOutcome : uint8_t {
+    ONGOING,
+    PLAYER_WON,
+    ENEMY_WON,
+    DRAW
+};
+
+/*
+    Campo de batalha: duas fileiras de criaturas frente a frente, uma por lado.
+    Cada criatura ataca a da mesma pista no lado oposto; pista vazia deixa o
+    golpe passar para o heroi. Os atributos ficam em arrays por lado (SoA) e uma
+    rodada e uma sequencia de passes sobre pistas inteiras:
+        AttackPass      dano que cada pista causa (0 se vazia ou congelada)
+        DamagePass      escudo, armadura, veneno e o que passa para o heroi
+        DeathSweep      lista as mortes e zera as pistas mortas
+        TriggerPass     efeitos de morte (poucos; escalar)
+        EndRoundPass    fim dos status que duram uma rodada
+    Os lacos de pista tem tamanho fixo e nenhum desvio: o compilador os vetoriza.
+    Copiar um Board e tirar um snapshot, como no Deck.
+
+    O hash de Zobrist acompanha cada mudanca: as operacoes de uma pista ou de um
+    heroi trocam so a chave dela na hora. Os passes em lote mexem em fileiras
+    inteiras e so marcam as pistas; GetHash recalcula a chave das pistas
+    ocupadas quando alguem pede: um rollout resolve dezenas de rodadas sem
+    consultar o hash nenhuma vez.
+*/
+class Board {
+    public:
+        // 8 pistas de int16: um registrador SSE por atributo
+        static constexpr int Lanes = 8;
+
+        struct Row {
+            alignas(16) std::array<int16_t, Lanes> health;
+            alignas(16) std::array<int16_t, Lanes> attack;
+            alignas(16) std::array<int16_t, Lanes> armor;
+            alignas(16) std::array<int16_t, Lanes> damage;  // causado na rodada atual
+            alignas(16) std::array<CardId, Lanes> card;     // InvalidCard: pista vazia
+            std::array<uint8_t, Lanes> flags;
+            std::array<CardEffect, Lanes> deathEffect;
+        };
+    private:
+        struct Death {
+            uint8_t side;
+            uint8_t lane;
+            CardEffect effect;
+        };
+
+        const CardDatabase* database;
+        std::array<Row, 2> rows;
+        std::array<Entity, 2> heroes;
+        std::array<int16_t, 2> heroMaxHealth;
+        // Cartas a comprar pedidas por efeitos de morte (DRAW), ate alguem consumir
+        std::array<int, 2> draws;
+
+        std::array<Death, 2 * Lanes> deaths;
+        uint32_t deathCount;
+        int rounds;
+
+        // Chave atual de cada pista (0 se vazia) e de cada heroi; 'hash' e o XOR de todas
+        std::array<std::array<uint64_t, Lanes>, 2> laneKeys;
+        std::array<uint64_t, 2> heroKeys;
+        uint64_t hash;
+        bool lanesStale;    // um passe em lote mudou pistas depois do ultimo rehash
+
+        static int Index(BoardSide side) { return (int)side; }
+
+        uint64_t LaneKey(int side, int lane) const;
+        uint64_t HeroKey(int side) const;
+        void RehashLane(int side, int lane);
+        void RehashLanes();
+        void RehashHero(int side);
+
+        // Retornam quanto dano (ou veneno) houve; 0 nas duas pontas e impasse
+        int AttackPass();
+        int DamagePass();
+        void DeathSweep();
+        void TriggerPass();
+        void EndRoundPass();
+    public:
+        explicit Board(const CardDatabase& database);
+
+        void Clear();
+
+        // false se a pista esta ocupada ou nao existe, ou se nao e uma criatura viva
+        bool Place(BoardSide side, int lane, const Entity& creature);
+        void Remove(BoardSide side, int lane);
+        // -1 se o lado esta cheio
+        int FirstFreeLane(BoardSide side) const;
+        Entity Get(BoardSide side, int lane) const;
+        const Row& GetRow(BoardSide side) const { return rows[Index(side)]; }
+        int CountCreatures(BoardSide side) const;
+
+        void SetHero(BoardSide side, const Entity& hero);
+        const Entity& GetHero(BoardSide side) const { return heroes[Index(side)]; }
+
+        // Efeitos de feitico, fora do combate; mortes e seus gatilhos resolvem na hora
+        void DamageCreature(BoardSide side, int lane, int amount);
+        void DamageHero(BoardSide side, int amount);
+        void HealHero(BoardSide side, int amount);
+        void AddHeroArmor(BoardSide side, int amount);
+        // Copias nas pistas livres a partir de 'lane', dando a volta; retorna quantas entraram
+        int Summon(BoardSide side, int lane, CardId card, int copies);
+
+        // Uma rodada de combate; false se ninguem causou dano (impasse)
+        bool ResolveRound();
+        // Rodadas ate alguem vencer, um impasse ou o limite; retorna quantas rodaram
+        int Resolve(int maxRounds);
+        CombatOutcome GetOutcome() const;
+        bool IsOver() const { return GetOutcome() != CombatOutcome::ONGOING; }
+        int GetRounds() const { return rounds; }
+
+        // Compras pendentes do lado; zera o contador
+        int TakeDraws(BoardSide side);
+
+        // Criaturas e herois. Nao e const: pode ter que refazer as pistas marcadas por um passe.
+        uint64_t GetHash();
+        // Do zero, para conferir o incremental
+        uint64_t ComputeHash() const;
+};
+
+static_assert(std::is_trivially_copyable_v<Board>, "Board e copiado como snapshot");
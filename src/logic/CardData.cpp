@@ -0,0 +1,210 @@
+#include "CardData.hpp"
+#include <iostream>
+#include <cstring>
+
+CardDataFile::CardDataFile() {
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    records = nullptr;
+    names = nullptr;
+}
+
+CardDataFile::~CardDataFile() {
+    Close();
+}
+
+bool CardDataFile::Open(const std::string& path) {
+    Close();
+    if (!file.Open(path)) return false;
+
+    data = file.GetData();
+    size = file.GetSize();
+
+    if (size < sizeof(CardDataHeader) || !Validate()) {
+        std::cerr << "Arquivo de cartas invalido: " << path << std::endl;
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool CardDataFile::Validate() {
+    header = (const CardDataHeader*)data;
+    if (memcmp(header->magic, CardDataMagic, sizeof(CardDataMagic)) != 0 || header->version != CardDataVersion) return false;
+
+    const uint64_t recordsSize = (uint64_t)header->count * sizeof(CardRecord);
+    if (header->recordsOffset % alignof(CardRecord) != 0) return false;
+    if (header->recordsOffset > size || recordsSize > size - header->recordsOffset) return false;
+    if (header->namesOffset > size || header->namesSize > size - header->namesOffset) return false;
+
+    records = (const CardRecord*)(data + header->recordsOffset);
+    names = (const char*)(data + header->namesOffset);
+
+    // Limites e campos conferidos uma vez; Get() nao precisa checar nada
+    for (uint32_t i = 0; i < header->count; i++) {
+        const CardRecord& record = records[i];
+        if ((uint64_t)record.nameOffset + record.nameLength > header->namesSize) return false;
+        if (record.nameLength == 0 || record.id == InvalidCard) return false;
+        if (i > 0 && records[i - 1].id >= record.id) return false;
+        if (record.type > (uint8_t)CardType::SPELL || record.manaCost > MaxManaCost) return false;
+
+        for (const CardEffectRecord& effect : record.effects) {
+            if (effect.type > (uint8_t)EffectType::SUMMON) return false;
+        }
+
+        // As mesmas regras da tabela base: um arquivo com uma carta quebrada e recusado inteiro
+        CardDefinition card = Get(i);
+        if (const char* error = CheckCardDefinition(card)) {
+            std::cerr << "Carta " << card.id << " (" << card.name << "): " << error << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CardDataFile::Open(const uint8_t* bytes, size_t size) {
+    Close();
+    data = bytes;
+    this->size = size;
+
+    if (size < sizeof(CardDataHeader) || !Validate()) {
+        std::cerr << "Arquivo de cartas invalido" << std::endl;
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void CardDataFile::Close() {
+    file.Close();
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    records = nullptr;
+    names = nullptr;
+}
+
+CardDefinition CardDataFile::Get(uint32_t index) const {
+    const CardRecord& record = records[index];
+
+    CardDefinition card;
+    card.id = record.id;
+    card.name = std::string_view(names + record.nameOffset, record.nameLength);
+    card.type = (CardType)record.type;
+    card.manaCost = record.manaCost;
+    card.attack = record.attack;
+    card.health = record.health;
+    for (size_t e = 0; e < MaxCardEffects; e++) {
+        card.effects[e] = { (EffectType)record.effects[e].type, record.effects[e].amount, record.effects[e].card };
+    }
+    card.nameHash = HashCardName(card.name);
+    return card;
+}
+
+int CardDataFile::ApplyTo(CardDatabase& database) const {
+    if (!header) return -1;
+
+    // Ids novos precisam continuar densos: cada um e exatamente o proximo livre
+    size_t nextId = database.Size();
+    for (uint32_t i = 0; i < header->count; i++) {
+        const CardRecord& record = records[i];
+        if (record.id > nextId) {
+            std::cerr << "Arquivo de cartas pula ids: " << record.id << " (proximo livre: " << nextId << ")" << std::endl;
+            return -1;
+        }
+        if (record.id == nextId) nextId++;
+    }
+
+    for (uint32_t i = 0; i < header->count; i++) {
+        const CardDefinition card = Get(i);
+
+        for (const CardEffect& effect : card.effects) {
+            if (effect.type != EffectType::SUMMON) continue;
+
+            // A carta invocada pode estar no arquivo (possivelmente nova) ou no banco
+            bool found = false;
+            bool creature = false;
+            for (uint32_t j = 0; j < header->count && !found; j++) {
+                if (records[j].id != effect.card) continue;
+                found = true;
+                creature = records[j].type == (uint8_t)CardType::CREATURE;
+            }
+            if (!found && database.IsValid(effect.card)) {
+                found = true;
+                creature = database.Get(effect.card).type == CardType::CREATURE;
+            }
+            if (!found || !creature) {
+                std::cerr << "Carta " << card.name << ": SUMMON precisa referenciar uma criatura" << std::endl;
+                return -1;
+            }
+        }
+
+        CardId existing = database.Find(card.name);
+        if (existing != InvalidCard && existing != card.id) {
+            std::cerr << "Nome de carta ja usado pelo id " << existing << ": " << card.name << std::endl;
+            return -1;
+        }
+    }
+
+    int changed = 0;
+    for (uint32_t i = 0; i < header->count; i++) {
+        if (database.Update(Get(i))) changed++;
+    }
+    return changed;
+}
+
+bool CardDataWriter::Add(const CardDefinition& definition) {
+    if (!cards.empty() && cards.back().id >= definition.id) {
+        std::cerr << "Ids fora de ordem: " << definition.id << " depois de " << cards.back().id << std::endl;
+        return false;
+    }
+    if (definition.name.empty() || definition.name.size() > UINT16_MAX) {
+        std::cerr << "Nome de carta invalido no id " << definition.id << std::endl;
+        return false;
+    }
+
+    cards.push_back(definition);
+    names.emplace_back(definition.name);
+    return true;
+}
+
+void CardDataWriter::Serialize(std::vector<uint8_t>& out) const {
+    std::string nameTable;
+    std::vector<CardRecord> table(cards.size());
+    for (size_t i = 0; i < cards.size(); i++) {
+        const CardDefinition& card = cards[i];
+        CardRecord& record = table[i];
+        record = {};
+        record.id = card.id;
+        record.type = (uint8_t)card.type;
+        record.manaCost = card.manaCost;
+        record.attack = card.attack;
+        record.health = card.health;
+        for (size_t e = 0; e < MaxCardEffects; e++) {
+            record.effects[e] = { (uint8_t)card.effects[e].type, 0, card.effects[e].amount, card.effects[e].card };
+        }
+        record.nameOffset = (uint32_t)nameTable.size();
+        record.nameLength = (uint16_t)names[i].size();
+        nameTable += names[i];
+    }
+
+    CardDataHeader header = {};
+    memcpy(header.magic, CardDataMagic, sizeof(CardDataMagic));
+    header.version = CardDataVersion;
+    header.count = (uint32_t)table.size();
+    header.recordsOffset = sizeof(CardDataHeader);
+    header.namesOffset = header.recordsOffset + (uint32_t)(table.size() * sizeof(CardRecord));
+    header.namesSize = (uint32_t)nameTable.size();
+
+    out.assign(header.namesOffset + nameTable.size(), 0);
+    memcpy(out.data(), &header, sizeof(header));
+    memcpy(out.data() + header.recordsOffset, table.data(), table.size() * sizeof(CardRecord));
+    memcpy(out.data() + header.namesOffset, nameTable.data(), nameTable.size());
+}
+
+bool CardDataWriter::Write(const std::string& path) const {
+    std::vector<uint8_t> bytes;
+    Serialize(bytes);
+    return WriteFileAtomic(path, bytes);
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "CardDatabase.hpp"
+#include "../core/MappedFile.hpp"
+
+/*
+    Formato binario de definicoes de cartas (little-endian), gerado por
+    tools/compile-cards a partir de um texto:
+        CardDataHeader
+        CardRecord[count], ordenado por id (crescente, sem repeticao)
+        nomes: bytes UTF-8 concatenados, sem terminador
+    Os registros sao lidos direto do arquivo mapeado, sem parsing. Um id que
+    ja existe no CardDatabase substitui a definicao; o proximo id livre cria uma carta.
+*/
+static constexpr char CardDataMagic[4] = { 'A', 'C', 'R', 'D' };
+static constexpr uint32_t CardDataVersion = 1;
+
+struct CardDataHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t recordsOffset;
+    uint32_t namesOffset;
+    uint32_t namesSize;
+};
+
+struct CardEffectRecord {
+    uint8_t type;
+    uint8_t reserved;
+    int16_t amount;
+    uint16_t card;
+};
+
+struct CardRecord {
+    uint16_t id;
+    uint8_t type;
+    uint8_t manaCost;
+    int16_t attack;
+    int16_t health;
+    CardEffectRecord effects[MaxCardEffects];
+    uint32_t nameOffset;
+    uint16_t nameLength;
+    uint16_t reserved;
+};
+
+static_assert(sizeof(CardDataHeader) == 24 && sizeof(CardRecord) == 28, "layout do arquivo de cartas mudou");
+
+// Leitor de um arquivo de cartas mapeado em memoria
+class CardDataFile {
+    private:
+        MappedFile file;
+        const uint8_t* data;
+        size_t size;
+        const CardDataHeader* header;
+        const CardRecord* records;
+        const char* names;
+
+        bool Validate();
+    public:
+        CardDataFile();
+        ~CardDataFile();
+
+        CardDataFile(const CardDataFile&) = delete;
+        CardDataFile& operator=(const CardDataFile&) = delete;
+
+        bool Open(const std::string& path);
+        // Le bytes ja em memoria (ex.: recem montados pelo CardDataWriter); eles precisam viver ate o Close
+        bool Open(const uint8_t* bytes, size_t size);
+        void Close();
+        bool IsOpen() const { return header != nullptr; }
+
+        uint32_t GetCount() const { return header ? header->count : 0; }
+        // 'name' aponta para o mapeamento: so vale enquanto o arquivo estiver aberto
+        CardDefinition Get(uint32_t index) const;
+
+        /*
+            Aplica as definicoes ao banco: so as que mudaram sao substituidas.
+            Confere tudo antes de tocar no banco; se algo for invalido nada muda.
+            Retorna o numero de definicoes alteradas ou criadas, ou -1 em erro.
+        */
+        int ApplyTo(CardDatabase& database) const;
+};
+
+// Monta um arquivo de cartas; grava com WriteFileAtomic, para quem observa o arquivo nunca ler pela metade
+class CardDataWriter {
+    private:
+        std::vector<CardDefinition> cards;
+        std::vector<std::string> names;
+    public:
+        // Os ids precisam vir em ordem crescente
+        bool Add(const CardDefinition& definition);
+        size_t Size() const { return cards.size(); }
+        // O arquivo inteiro, sem gravar; da para validar com CardDataFile antes de trocar o do disco
+        void Serialize(std::vector<uint8_t>& out) const;
+        bool Write(const std::string& path) const;
+};
@@ -0,0 +1,96 @@
+#include "CardDatabase.hpp"
+#include "BaseCards.hpp"
+#include <algorithm>
+#include <iostream>
+
+CardId CardDatabase::Add(const CardDefinition& definition) {
+    if (definitions.size() >= InvalidCard) {
+        std::cerr << "Tabela de cartas cheia: " << definition.name << std::endl;
+        return InvalidCard;
+    }
+    if (Find(definition.name) != InvalidCard) {
+        std::cerr << "Carta repetida: " << definition.name << std::endl;
+        return InvalidCard;
+    }
+
+    // O nome de quem chamou pode nao durar; a copia fica na posicao do id
+    ownedNames.resize(definitions.size());
+    ownedNames.emplace_back(definition.name);
+
+    CardDefinition& added = definitions.emplace_back(definition);
+    added.id = (CardId)(definitions.size() - 1);
+    added.name = ownedNames.back();
+    added.nameHash = HashCardName(added.name);
+
+    byName.emplace(added.name, added.id);
+    return added.id;
+}
+
+void CardDatabase::AddBaseSet() {
+    if (!definitions.empty()) {
+        std::cerr << "Conjunto base precisa ser o primeiro a entrar no CardDatabase" << std::endl;
+        return;
+    }
+
+    // Ja validada e com hashes prontos: so uma copia
+    definitions.assign(BaseCards.begin(), BaseCards.end());
+    baseCount = BaseCards.size();
+}
+
+bool CardDatabase::Update(const CardDefinition& definition) {
+    if (definition.id == definitions.size()) {
+        return Add(definition) != InvalidCard;
+    }
+    if (!IsValid(definition.id)) {
+        std::cerr << "Id de carta fora da tabela: " << definition.id << std::endl;
+        return false;
+    }
+
+    CardDefinition& current = definitions[definition.id];
+    CardDefinition updated = definition;
+    updated.nameHash = HashCardName(updated.name);
+    if (updated == current) return false;
+
+    if (updated.name != current.name) {
+        byName.erase(current.name);
+        // Troca o nome guardado do id em vez de acumular um por recarga
+        if (ownedNames.size() <= updated.id) ownedNames.resize(updated.id + 1);
+        ownedNames[updated.id].assign(updated.name);
+        updated.name = ownedNames[updated.id];
+        byName[updated.name] = updated.id;
+    } else {
+        // Mantem o nome atual: 'definition.name' pode apontar para um arquivo que vai ser fechado
+        updated.name = current.name;
+    }
+
+    current = updated;
+    return true;
+}
+
+CardId CardDatabase::Find(std::string_view name) const {
+    if (baseCount > 0) {
+        // A definicao base pode ter sido renomeada pelo arquivo de cartas
+        CardId id = BaseCardIndex.Find(name, BaseCards);
+        if (id != InvalidCard && definitions[id].name == name) return id;
+    }
+
+    auto it = byName.find(name);
+    return it != byName.end() ? it->second : InvalidCard;
+}
+
+int CardDatabase::GetManaCost(const CardInstance& instance) const {
+    return std::max(0, definitions[instance.id].manaCost + instance.costModifier);
+}
+
+int CardDatabase::GetAttack(const CardInstance& instance) const {
+    return std::max(0, definitions[instance.id].attack + instance.attackModifier);
+}
+
+int CardDatabase::GetHealth(const CardInstance& instance) const {
+    return std::max(0, definitions[instance.id].health + instance.healthModifier);
+}
+
+uint64_t CardDatabase::GetVisualHash(const CardInstance& instance) const {
+    const CardDefinition& definition = definitions[instance.id];
+    return (definition.nameHash * 31 + (uint64_t)definition.type) * 31 + (uint64_t)GetManaCost(instance);
+}
@@ -0,0 +1,158 @@
+#pragma once
+#include <array>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "../core/Hash.hpp"
+#include "../objects/CardType.hpp"
+
+using CardId = uint16_t;
+inline constexpr CardId InvalidCard = UINT16_MAX;
+inline constexpr int MaxManaCost = 10;
+
+enum class EffectType : uint8_t {
+    NONE,
+    DAMAGE,
+    HEAL,
+    ARMOR,
+    DRAW,
+    SUMMON      // invoca 'amount' copias da criatura 'card'
+};
+
+struct CardEffect {
+    EffectType type = EffectType::NONE;
+    int16_t amount = 0;
+    CardId card = InvalidCard;  // carta referenciada (SUMMON)
+
+    constexpr bool operator==(const CardEffect& other) const = default;
+};
+
+inline constexpr size_t MaxCardEffects = 2;
+
+constexpr uint64_t HashCardName(std::string_view name) {
+    return HashFnv1a(name);
+}
+
+/*
+    Definicao imutavel, compartilhada por todas as copias da carta. E um tipo
+    literal: a tabela base (BaseCards.hpp) e montada e validada em tempo de compilacao.
+    'name' aponta para armazenamento estatico ou para nomes guardados pelo CardDatabase.
+*/
+struct CardDefinition {
+    CardId id = InvalidCard;
+    std::string_view name;
+    CardType type = CardType::CREATURE;
+    uint8_t manaCost = 0;
+    int16_t attack = 0;     // so criaturas
+    int16_t health = 0;
+    std::array<CardEffect, MaxCardEffects> effects = {};
+    uint64_t nameHash = 0;
+
+    constexpr bool operator==(const CardDefinition& other) const = default;
+};
+
+// Avaliada em tempo de compilacao, a regra quebrada vira erro apontando para a mensagem
+constexpr const char* CardRuleBroken(const char* message) {
+    if consteval {
+        throw message;
+    }
+    return message;
+}
+
+/*
+    Regras de uma definicao sozinha, as mesmas para a tabela base (static_assert
+    em BaseCards.hpp) e para um arquivo de cartas recarregado. nullptr se a carta
+    e valida; senao, a regra quebrada. As regras entre cartas (ids densos, nomes
+    repetidos, alvo do SUMMON) ficam com quem conhece o conjunto inteiro.
+*/
+constexpr const char* CheckCardDefinition(const CardDefinition& card) {
+    if (card.name.empty()) return CardRuleBroken("carta sem nome");
+    if (card.nameHash != HashCardName(card.name)) return CardRuleBroken("nameHash nao confere com o nome");
+    if (card.manaCost > MaxManaCost) return CardRuleBroken("custo de mana fora do intervalo");
+
+    if (card.type == CardType::CREATURE) {
+        if (card.health <= 0 || card.attack < 0) return CardRuleBroken("criatura precisa de vida > 0 e ataque >= 0");
+    } else {
+        if (card.attack != 0 || card.health != 0) return CardRuleBroken("feitico nao tem ataque nem vida");
+        if (card.effects[0].type == EffectType::NONE) return CardRuleBroken("feitico sem efeito");
+    }
+
+    bool ended = false;
+    for (const CardEffect& effect : card.effects) {
+        if (effect.type == EffectType::NONE) {
+            ended = true;
+            continue;
+        }
+        if (ended) return CardRuleBroken("efeito depois de um espaco vazio");
+        if (effect.amount <= 0) return CardRuleBroken("efeito com quantidade <= 0");
+
+        if (effect.type == EffectType::SUMMON) {
+            if (effect.card == card.id) return CardRuleBroken("carta invocando a si mesma");
+        } else if (effect.card != InvalidCard) {
+            return CardRuleBroken("so SUMMON referencia outra carta");
+        }
+    }
+    return nullptr;
+}
+
+enum CardInstanceFlags : uint8_t {
+    CARD_UPGRADED  = 1u << 0,
+    CARD_TEMPORARY = 1u << 1    // sai do baralho no fim da batalha
+};
+
+// Carta em jogo: o id da definicao e o que mudou nesta copia. Copiar e mover e copiar inteiros.
+struct CardInstance {
+    CardId id = InvalidCard;
+    int8_t costModifier = 0;
+    int8_t attackModifier = 0;
+    int8_t healthModifier = 0;
+    uint8_t flags = 0;
+};
+
+static_assert(sizeof(CardInstance) <= 8, "CardInstance deve continuar cabendo em 8 bytes");
+
+/*
+    Tabela de definicoes indexada por CardId. As definicoes so mudam na thread
+    principal, com nenhuma cena sendo montada (inicializacao e recarga do
+    arquivo de cartas); fora disso pode ser lida de qualquer thread.
+    O conjunto base vem pronto de BaseCards.hpp: nada e calculado ao carregar,
+    e os nomes base sao achados pelo hash perfeito gerado na compilacao.
+*/
+class CardDatabase {
+    private:
+        std::vector<CardDefinition> definitions;
+        size_t baseCount;
+        // So as cartas adicionadas em tempo de execucao; os nomes vivem em ownedNames
+        std::unordered_map<std::string_view, CardId> byName;
+        // Indexado pelo CardId (vazio enquanto a carta usa o nome estatico da tabela base);
+        // o deque cresce sem mover os nomes ja guardados
+        std::deque<std::string> ownedNames;
+    public:
+        CardDatabase() : baseCount(0) {}
+
+        CardDatabase(const CardDatabase&) = delete;
+        CardDatabase& operator=(const CardDatabase&) = delete;
+
+        // InvalidCard se o nome ja existe ou a tabela esta cheia. O id e o proximo livre.
+        CardId Add(const CardDefinition& definition);
+        // Cartas do jogo base; precisa vir antes de qualquer Add, para os ids baterem com a tabela
+        void AddBaseSet();
+        // Substitui a definicao de mesmo id, ou cria a carta se o id e o proximo livre.
+        // Retorna true se algo mudou.
+        bool Update(const CardDefinition& definition);
+
+        CardId Find(std::string_view name) const;
+        bool IsValid(CardId id) const { return id < definitions.size(); }
+        const CardDefinition& Get(CardId id) const { return definitions[id]; }
+        size_t Size() const { return definitions.size(); }
+
+        // Valores da copia, ja com os modificadores
+        int GetManaCost(const CardInstance& instance) const;
+        int GetAttack(const CardInstance& instance) const;
+        int GetHealth(const CardInstance& instance) const;
+        // Identifica a aparencia da copia no CardFaceCache
+        uint64_t GetVisualHash(const CardInstance& instance) const;
+};
@@ -0,0 +1,158 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <utility>
+#include <string_view>
+#include <cstdint>
+#include "CardDatabase.hpp"
+
+// Construtores para tabelas constexpr de cartas
+constexpr CardDefinition Creature(CardId id, std::string_view name, uint8_t manaCost, int16_t attack, int16_t health,
+                                  CardEffect effect = {}) {
+    CardDefinition card;
+    card.id = id;
+    card.name = name;
+    card.type = CardType::CREATURE;
+    card.manaCost = manaCost;
+    card.attack = attack;
+    card.health = health;
+    card.effects[0] = effect;
+    card.nameHash = HashCardName(name);
+    return card;
+}
+
+constexpr CardDefinition Spell(CardId id, std::string_view name, uint8_t manaCost, CardEffect first,
+                               CardEffect second = {}) {
+    CardDefinition card;
+    card.id = id;
+    card.name = name;
+    card.type = CardType::SPELL;
+    card.manaCost = manaCost;
+    card.effects[0] = first;
+    card.effects[1] = second;
+    card.nameHash = HashCardName(name);
+    return card;
+}
+
+/*
+    Regras de uma tabela de cartas: as de cada definicao (CheckCardDefinition) e
+    as entre cartas. Usada em static_assert: uma regra quebrada vira erro de
+    compilacao apontando para a mensagem.
+*/
+template <size_t N>
+consteval bool ValidateCardTable(const std::array<CardDefinition, N>& table) {
+    if (N >= InvalidCard) throw "tabela grande demais para CardId";
+
+    for (size_t i = 0; i < N; i++) {
+        const CardDefinition& card = table[i];
+
+        if (card.id != i) throw "ids devem ser densos e na ordem da tabela";
+        CheckCardDefinition(card);
+        for (size_t j = 0; j < i; j++) {
+            if (table[j].name == card.name) throw "nome de carta repetido";
+        }
+
+        for (const CardEffect& effect : card.effects) {
+            if (effect.type != EffectType::SUMMON) continue;
+            if (effect.card >= N) throw "SUMMON referencia uma carta fora da tabela";
+            if (table[effect.card].type != CardType::CREATURE) throw "SUMMON deve referenciar uma criatura";
+        }
+    }
+    return true;
+}
+
+// Mistura final (splitmix64): espalha os bits do FNV antes de usar os mais baixos
+constexpr uint64_t MixCardHash(uint64_t hash) {
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ull;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebull;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+/*
+    Hash perfeito nome -> id (hash-and-displace): o nome cai num balde, e o
+    deslocamento do balde leva a um slot que nenhum outro nome usa. Busca com
+    um hash, duas misturas e uma comparacao de string, sem colisoes.
+*/
+template <size_t N>
+struct CardNameIndex {
+    static constexpr size_t Buckets = std::bit_ceil(N > 0 ? N : 1);
+    static constexpr size_t Slots = Buckets * 2;
+
+    std::array<uint16_t, Buckets> displacement = {};
+    std::array<CardId, Slots> slots = {};
+
+    static constexpr size_t BucketOf(uint64_t hash) { return MixCardHash(hash) & (Buckets - 1); }
+    static constexpr size_t SlotOf(uint64_t hash, uint16_t displacement) {
+        return MixCardHash(hash ^ (0x9e3779b97f4a7c15ull * (displacement + 1))) & (Slots - 1);
+    }
+
+    constexpr CardId Find(std::string_view name, const std::array<CardDefinition, N>& table) const {
+        const uint64_t hash = HashCardName(name);
+        const CardId id = slots[SlotOf(hash, displacement[BucketOf(hash)])];
+        return (id != InvalidCard && table[id].name == name) ? id : InvalidCard;
+    }
+};
+
+template <size_t N>
+consteval CardNameIndex<N> BuildCardNameIndex(const std::array<CardDefinition, N>& table) {
+    using Index = CardNameIndex<N>;
+    Index index;
+    index.slots.fill(InvalidCard);
+
+    // Cartas agrupadas por balde: members[first[b] .. first[b + 1])
+    std::array<size_t, Index::Buckets + 1> first = {};
+    for (size_t i = 0; i < N; i++) {
+        first[Index::BucketOf(table[i].nameHash) + 1]++;
+    }
+    for (size_t b = 0; b < Index::Buckets; b++) {
+        first[b + 1] += first[b];
+    }
+
+    std::array<size_t, N> members = {};
+    std::array<size_t, Index::Buckets> filled = {};
+    for (size_t i = 0; i < N; i++) {
+        size_t bucket = Index::BucketOf(table[i].nameHash);
+        members[first[bucket] + filled[bucket]++] = i;
+    }
+
+    // Baldes maiores primeiro: sao os mais dificeis de encaixar
+    std::array<size_t, Index::Buckets> order = {};
+    for (size_t b = 0; b < Index::Buckets; b++) order[b] = b;
+    for (size_t a = 1; a < Index::Buckets; a++) {
+        for (size_t b = a; b > 0 && filled[order[b]] > filled[order[b - 1]]; b--) {
+            std::swap(order[b], order[b - 1]);
+        }
+    }
+
+    std::array<size_t, N> taken = {};
+    for (size_t bucket : order) {
+        const size_t count = filled[bucket];
+        if (count == 0) break;
+
+        bool placed = false;
+        for (uint32_t d = 0; d <= UINT16_MAX && !placed; d++) {
+            placed = true;
+
+            for (size_t m = 0; m < count && placed; m++) {
+                size_t slot = Index::SlotOf(table[members[first[bucket] + m]].nameHash, (uint16_t)d);
+                if (index.slots[slot] != InvalidCard) placed = false;
+                for (size_t t = 0; t < m && placed; t++) {
+                    if (taken[t] == slot) placed = false;
+                }
+                taken[m] = slot;
+            }
+
+            if (placed) {
+                index.displacement[bucket] = (uint16_t)d;
+                for (size_t m = 0; m < count; m++) {
+                    index.slots[taken[m]] = (CardId)members[first[bucket] + m];
+                }
+            }
+        }
+        if (!placed) throw "nenhum deslocamento encaixa o balde";
+    }
+    return index;
+}
@@ -0,0 +1,75 @@
+#include "Deck.hpp"
+#include <algorithm>
+#include <utility>
+
+Deck::Deck(uint64_t seed) : cards(), random(seed) {
+    drawCount = 0;
+    discardCount = 0;
+}
+
+Deck::Deck(const Random& random) : cards(), random(random) {
+    drawCount = 0;
+    discardCount = 0;
+}
+
+void Deck::ShuffleRange(uint32_t count) {
+    // Fisher-Yates: j sai de uma multiplicacao, e a troca acontece mesmo quando j == i
+    for (uint32_t i = count; i > 1; i--) {
+        uint32_t j = random.Below(i);
+        std::swap(cards[i - 1], cards[j]);
+    }
+}
+
+bool Deck::Add(CardId id) {
+    if (IsFull()) return false;
+
+    cards[drawCount++] = id;
+    return true;
+}
+
+bool Deck::ShuffleIn(CardId id) {
+    if (IsFull()) return false;
+
+    uint32_t j = random.Below(drawCount + 1);
+    cards[drawCount] = cards[j];
+    cards[j] = id;
+    drawCount++;
+    return true;
+}
+
+void Deck::Reshuffle() {
+    // O descarte ja esta contiguo no fim; basta encosta-lo na compra
+    std::copy(cards.end() - discardCount, cards.end(), cards.begin() + drawCount);
+    drawCount += discardCount;
+    discardCount = 0;
+
+    Shuffle();
+}
+
+CardId Deck::Draw() {
+    if (drawCount == 0) {
+        if (discardCount == 0) return InvalidCard;
+        Reshuffle();
+    }
+
+    return cards[--drawCount];
+}
+
+bool Deck::Discard(CardId id) {
+    if (IsFull()) return false;
+
+    cards[Capacity - ++discardCount] = id;
+    return true;
+}
+
+void Deck::Clear() {
+    drawCount = 0;
+    discardCount = 0;
+}
+
+bool Deck::operator==(const Deck& other) const {
+    return drawCount == other.drawCount && discardCount == other.discardCount &&
+        random == other.random &&
+        std::equal(cards.begin(), cards.begin() + drawCount, other.cards.begin()) &&
+        std::equal(cards.end() - discardCount, cards.end(), other.cards.end() - discardCount);
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "CardDatabase.hpp"
+#include "Random.hpp"
+
+/*
+    Compra e descarte de uma batalha, num unico array de capacidade fixa:
+        [0, drawCount)                  compra; o topo e o ultimo
+        [Capacity - discardCount, ...)  descarte; cresce do fim para o inicio
+    Comprar e descartar sao O(1); embaralhar e O(n) sem desvios alem do laco.
+    O gerador vai junto: o mesmo baralho com a mesma semente compra sempre na mesma
+    ordem. Copiar um Deck (memcpy) e tirar um snapshot, util para a busca do oponente.
+*/
+class Deck {
+    public:
+        static constexpr uint32_t Capacity = 64;
+    private:
+        std::array<CardId, Capacity> cards;
+        uint32_t drawCount;
+        uint32_t discardCount;
+        Random random;
+
+        void ShuffleRange(uint32_t count);
+    public:
+        explicit Deck(uint64_t seed = 0);
+        explicit Deck(const Random& random);
+
+        // false se o baralho esta cheio; a carta entra no topo da compra, sem embaralhar
+        bool Add(CardId id);
+        // Coloca a carta numa posicao sorteada da compra
+        bool ShuffleIn(CardId id);
+        void Shuffle() { ShuffleRange(drawCount); }
+        // Devolve o descarte a compra e embaralha tudo
+        void Reshuffle();
+        // Com a compra vazia, reembaralha o descarte; InvalidCard se nao ha nenhuma carta
+        CardId Draw();
+        bool Discard(CardId id);
+        void Clear();
+
+        uint32_t GetDrawCount() const { return drawCount; }
+        uint32_t GetDiscardCount() const { return discardCount; }
+        uint32_t Size() const { return drawCount + discardCount; }
+        bool IsFull() const { return Size() == Capacity; }
+        // i = 0 e o topo da compra
+        CardId PeekDraw(uint32_t i) const { return i < drawCount ? cards[drawCount - 1 - i] : InvalidCard; }
+
+        Random& GetRandom() { return random; }
+        const Random& GetRandom() const { return random; }
+
+        bool operator==(const Deck& other) const;
+};
+
+static_assert(std::is_trivially_copyable_v<Deck>, "Deck e copiado como snapshot");
@@ -0,0 +1,31 @@
+#include "Entity.hpp"
+
+Entity MakeCreature(const CardDatabase& database, const CardInstance& instance) {
+    Entity entity;
+    if (!database.IsValid(instance.id)) return entity;
+
+    const CardDefinition& definition = database.Get(instance.id);
+    if (definition.type != CardType::CREATURE) return entity;
+
+    entity.card = instance.id;
+    entity.health = (int16_t)database.GetHealth(instance);
+    entity.attack = (int16_t)database.GetAttack(instance);
+
+    // Armadura e propria; os outros efeitos de criatura disparam na morte
+    for (const CardEffect& effect : definition.effects) {
+        if (effect.type == EffectType::ARMOR) {
+            entity.armor += effect.amount;
+        } else if (effect.type != EffectType::NONE && entity.deathEffect.type == EffectType::NONE) {
+            entity.deathEffect = effect;
+        }
+    }
+
+    return entity;
+}
+
+Entity MakeHero(int health, int armor) {
+    Entity hero;
+    hero.health = (int16_t)health;
+    hero.armor = (int16_t)armor;
+    return hero;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include "CardDatabase.hpp"
+
+enum StatusFlags : uint8_t {
+    STATUS_FROZEN   = 1u << 0,  // nao ataca nesta rodada; descongela no fim dela
+    STATUS_POISONED = 1u << 1,  // perde 1 de vida por rodada, ignorando armadura
+    STATUS_SHIELDED = 1u << 2   // o primeiro dano recebido e anulado
+};
+
+/*
+    Uma criatura ou heroi, inteiro, para colocar no Board e ler de volta.
+    Dentro do Board esses campos ficam espalhados em arrays por lado (SoA);
+    este struct so existe nas bordas, nunca nos passes de combate.
+*/
+struct Entity {
+    CardId card = InvalidCard;      // InvalidCard para herois
+    int16_t health = 0;
+    int16_t attack = 0;
+    int16_t armor = 0;
+    uint8_t flags = 0;
+    // Disparado quando a criatura morre (o efeito da carta)
+    CardEffect deathEffect;
+
+    bool operator==(const Entity& other) const = default;
+};
+
+// Criatura da carta, com os modificadores da copia; card = InvalidCard se nao e criatura
+Entity MakeCreature(const CardDatabase& database, const CardInstance& instance);
+Entity MakeHero(int health, int armor = 0);
@@ -0,0 +1,296 @@
+#include "Opponent.hpp"
+#include <algorithm>
+#include <cmath>
+
+struct SearchNode {
+    BattleMove move;        // jogada que levou a este no
+    BoardSide mover;        // quem fez a jogada; 'value' e do ponto de vista dele
+    bool expanded;
+    uint16_t childCount;
+    uint32_t parent;
+    uint32_t firstChild;
+    uint32_t visits;
+    float value;
+};
+
+// Acima disso a arvore para de crescer; as iteracoes seguem so com rollouts
+static constexpr size_t MaxNodes = 1 << 20;
+
+// Posicao inacabada: vida dos herois e criaturas em campo, de 0 (inimigo vence) a 1 (jogador vence)
+static float Evaluate(const Battle& state) {
+    switch (state.GetOutcome()) {
+        case CombatOutcome::PLAYER_WON: return 1.0f;
+        case CombatOutcome::ENEMY_WON: return 0.0f;
+        case CombatOutcome::DRAW: return 0.5f;
+        case CombatOutcome::ONGOING: break;
+    }
+
+    const Board& board = state.GetBoard();
+    float score = 0.0f;
+    for (BoardSide side : { BoardSide::PLAYER, BoardSide::ENEMY }) {
+        const Entity& hero = board.GetHero(side);
+        const Board::Row& row = board.GetRow(side);
+
+        float power = (float)(hero.health + hero.armor);
+        for (int i = 0; i < Board::Lanes; i++) {
+            power += 0.5f * (row.attack[i] + row.health[i]);
+        }
+        score += side == BoardSide::PLAYER ? power : -power;
+    }
+
+    return std::clamp(0.5f + score / 60.0f, 0.05f, 0.95f);
+}
+
+// Jogadas ao acaso ate o fim ou ate 'turns' trocas de vez
+static float Rollout(Battle& state, Random& random, int turns) {
+    Battle::MoveList moves;
+
+    while (turns > 0 && !state.IsOver()) {
+        int count = state.GetMoves(moves);
+        const BattleMove& move = moves[random.Below((uint32_t)count)];
+        if (move.type == MoveType::END_TURN) turns--;
+        state.Apply(move);
+    }
+
+    return Evaluate(state);
+}
+
+class SearchTree {
+    private:
+        std::vector<SearchNode> nodes;
+        float exploration;
+
+        void Expand(uint32_t index, const Battle& state) {
+            Battle::MoveList moves;
+            int count = state.GetMoves(moves);
+
+            SearchNode& node = nodes[index];
+            node.expanded = true;
+            if (state.IsOver() || nodes.size() + count > MaxNodes) return;
+
+            node.firstChild = (uint32_t)nodes.size();
+            node.childCount = (uint16_t)count;
+
+            BoardSide mover = state.GetActive();
+            for (int i = 0; i < count; i++) {
+                nodes.push_back({ moves[i], mover, false, 0, index, 0, 0, 0.0f });
+            }
+        }
+
+        uint32_t SelectChild(uint32_t index) const {
+            const SearchNode& node = nodes[index];
+            float logVisits = std::log((float)std::max<uint32_t>(node.visits, 1));
+
+            uint32_t best = node.firstChild;
+            float bestScore = -1.0f;
+            for (uint32_t i = node.firstChild; i < node.firstChild + node.childCount; i++) {
+                const SearchNode& child = nodes[i];
+                // Filho nunca visitado tem prioridade
+                if (child.visits == 0) return i;
+
+                float score = child.value / child.visits + exploration * std::sqrt(logVisits / child.visits);
+                if (score > bestScore) {
+                    bestScore = score;
+                    best = i;
+                }
+            }
+            return best;
+        }
+    public:
+        explicit SearchTree(float exploration) : exploration(exploration) {
+            nodes.reserve(1 << 14);
+        }
+
+        void Reset(const Battle& state) {
+            nodes.clear();
+            nodes.push_back({ BattleMove(), state.GetActive(), false, 0, 0, 0, 0, 0.0f });
+            Expand(0, state);
+        }
+
+        // true se a avaliacao da folha veio da tabela
+        bool Iterate(const Battle& base, Random& random, const OpponentSettings& settings, TranspositionTable* table) {
+            Battle state = base;
+            uint32_t index = 0;
+
+            // Selecao: desce pelos filhos ja abertos
+            while (nodes[index].expanded && nodes[index].childCount > 0) {
+                index = SelectChild(index);
+                state.Apply(nodes[index].move);
+            }
+
+            // Expansao: abre a folha e segue por um filho sorteado
+            if (!nodes[index].expanded) {
+                Expand(index, state);
+                const SearchNode& leaf = nodes[index];
+                if (leaf.childCount > 0) {
+                    index = leaf.firstChild + random.Below(leaf.childCount);
+                    state.Apply(nodes[index].move);
+                }
+            }
+
+            float result;
+            bool hit = false;
+            TranspositionEntry entry;
+            uint64_t hash = state.GetHash();
+            if (table && table->Probe(hash, entry) && entry.visits >= settings.tableMinVisits) {
+                result = entry.value;
+                hit = true;
+            } else {
+                result = Rollout(state, random, settings.rolloutTurns);
+                if (table) table->Store(hash, result);
+            }
+
+            for (;;) {
+                SearchNode& node = nodes[index];
+                node.visits++;
+                node.value += node.mover == BoardSide::PLAYER ? result : 1.0f - result;
+                if (index == 0) break;
+                index = node.parent;
+            }
+            return hit;
+        }
+
+        const SearchNode& GetRoot() const { return nodes[0]; }
+        const SearchNode& GetNode(uint32_t index) const { return nodes[index]; }
+};
+
+Opponent::Opponent(ThreadPool& pool, const CardDatabase& database, uint64_t seed,
+    const OpponentSettings& settings, TranspositionTable* table)
+    : pool(pool), table(table), settings(settings), random(seed), root(database, 0) {
+    running = 0;
+    lastIterations = 0;
+    lastTableHits = 0;
+}
+
+Opponent::~Opponent() {
+    Wait();
+}
+
+void Opponent::SetSettings(const OpponentSettings& settings) {
+    Wait();
+    this->settings = settings;
+}
+
+void Opponent::SetTable(TranspositionTable* table) {
+    Wait();
+    this->table = table;
+}
+
+void Opponent::Search(Random random, std::chrono::steady_clock::time_point deadline, RootStats& out) const {
+    SearchTree tree(settings.exploration);
+    Battle world = root;
+    BoardSide viewer = root.GetActive();
+
+    int worldIterations = settings.determinize ? std::max(settings.iterationsPerWorld, 1) : INT32_MAX;
+    uint64_t limit = settings.maxIterations > 0 ? (uint64_t)settings.maxIterations : UINT64_MAX;
+
+    while (out.iterations < limit) {
+        if (settings.determinize) {
+            world = root;
+            world.Determinize(viewer, random);
+        }
+        tree.Reset(world);
+
+        int done = 0;
+        for (; done < worldIterations && out.iterations < limit; done++, out.iterations++) {
+            // O relogio custa mais que uma iteracao curta: consulta a cada 32
+            if (settings.maxIterations == 0 && (out.iterations & 31) == 0 &&
+                std::chrono::steady_clock::now() >= deadline) break;
+            out.tableHits += tree.Iterate(world, random, settings, table);
+        }
+
+        // As jogadas da raiz so dependem do que o lado da vez ve: iguais em toda amostra
+        const SearchNode& top = tree.GetRoot();
+        for (uint32_t i = 0; i < top.childCount; i++) {
+            const SearchNode& child = tree.GetNode(top.firstChild + i);
+            out.visits[i] += child.visits;
+            out.value[i] += child.value;
+        }
+
+        if (done < worldIterations && out.iterations < limit) break;
+    }
+}
+
+void Opponent::Start(const Battle& state) {
+    Wait();
+
+    root = state;
+    Battle::MoveList moves;
+    int count = state.GetMoves(moves);
+
+    // Uma jogada so, ou a batalha acabou: nao ha o que buscar
+    if (count <= 1 || state.IsOver()) {
+        best = moves[0];
+        lastIterations = 0;
+        lastTableHits = 0;
+        return;
+    }
+
+    unsigned tasks = settings.threads ? settings.threads : std::max(pool.GetThreadCount(), 1u);
+    results.assign(tasks, RootStats());
+    for (RootStats& stats : results) {
+        stats.moves.assign(moves.begin(), moves.begin() + count);
+        stats.visits.assign(count, 0);
+        stats.value.assign(count, 0.0f);
+    }
+
+    if (table) table->NewSearch();
+
+    auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(settings.budgetMs));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = tasks;
+    }
+
+    for (RootStats& stats : results) {
+        // Cada tarefa com sua sequencia; todas derivadas da semente do Opponent
+        pool.Submit([this, taskRandom = random.Split(), deadline, &stats] {
+            Search(taskRandom, deadline, stats);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--running == 0) finished.notify_all();
+        });
+    }
+}
+
+bool Opponent::IsDone() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return running == 0;
+}
+
+BattleMove Opponent::Merge() {
+    if (results.empty()) return best;
+
+    RootStats& total = results[0];
+    for (size_t t = 1; t < results.size(); t++) {
+        for (size_t i = 0; i < total.moves.size(); i++) {
+            total.visits[i] += results[t].visits[i];
+            total.value[i] += results[t].value[i];
+        }
+        total.iterations += results[t].iterations;
+        total.tableHits += results[t].tableHits;
+    }
+
+    // Mais visitada; empate decidido pelo valor medio
+    size_t chosen = 0;
+    for (size_t i = 1; i < total.moves.size(); i++) {
+        uint64_t a = total.visits[i], b = total.visits[chosen];
+        if (a > b || (a == b && a > 0 && total.value[i] / a > total.value[chosen] / b)) chosen = i;
+    }
+
+    best = total.moves[chosen];
+    lastIterations = total.iterations;
+    lastTableHits = total.tableHits;
+    results.clear();
+    return best;
+}
+
+BattleMove Opponent::Wait() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this] { return running == 0; });
+    }
+    return Merge();
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <vector>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include "Battle.hpp"
+#include "TranspositionTable.hpp"
+#include "../core/ThreadPool.hpp"
+
+struct OpponentSettings {
+    // Tempo de busca por jogada
+    double budgetMs = 50.0;
+    // > 0: para depois de tantas iteracoes por thread, sem olhar o relogio (reproduzivel)
+    int maxIterations = 0;
+    // Tarefas de busca em paralelo; 0 usa todas as threads do pool
+    unsigned threads = 0;
+    // Sem isso a busca enxerga a mao e o baralho do adversario
+    bool determinize = true;
+    // Iteracoes em cada amostra da informacao escondida antes de sortear outra
+    int iterationsPerWorld = 256;
+    // Turnos jogados ao acaso a partir da folha antes de avaliar a posicao
+    int rolloutTurns = 6;
+    float exploration = 1.4f;
+    // Folha ja avaliada tantas vezes na TranspositionTable usa a media de la em vez de um rollout
+    uint32_t tableMinVisits = 4;
+};
+
+/*
+    Oponente por busca em arvore de Monte Carlo (UCT), paralela na raiz:
+    cada tarefa do ThreadPool monta arvores proprias a partir de uma copia do
+    estado, sem nada compartilhado, e no fim as visitas de cada jogada da raiz
+    sao somadas. Com determinize, cada arvore parte de uma amostra diferente
+    da mao e do baralho do adversario (Battle::Determinize).
+    Start() nao bloqueia: a thread principal consulta IsDone() a cada quadro.
+    Com uma TranspositionTable, todas as tarefas (e qualquer outro usuario da
+    tabela) reaproveitam a avaliacao de posicoes ja vistas por outra ordem de jogadas.
+*/
+class Opponent {
+    private:
+        struct RootStats {
+            std::vector<BattleMove> moves;
+            std::vector<uint32_t> visits;
+            std::vector<float> value;
+            uint64_t iterations = 0;
+            uint64_t tableHits = 0;
+        };
+
+        ThreadPool& pool;
+        TranspositionTable* table;
+        OpponentSettings settings;
+        Random random;
+
+        Battle root;
+        std::vector<RootStats> results;
+        std::mutex mutex;
+        std::condition_variable finished;
+        unsigned running;
+
+        BattleMove best;
+        uint64_t lastIterations;
+        uint64_t lastTableHits;
+
+        void Search(Random random, std::chrono::steady_clock::time_point deadline, RootStats& out) const;
+        BattleMove Merge();
+    public:
+        // A semente decide os sorteios da busca; sem tabela, a mesma semente repete a busca com maxIterations
+        Opponent(ThreadPool& pool, const CardDatabase& database, uint64_t seed,
+            const OpponentSettings& settings = {}, TranspositionTable* table = nullptr);
+        ~Opponent();
+
+        Opponent(const Opponent&) = delete;
+        Opponent& operator=(const Opponent&) = delete;
+
+        // Comeca a buscar a jogada do lado da vez; o estado e copiado
+        void Start(const Battle& state);
+        bool IsDone();
+        // Bloqueia ate a busca terminar e retorna a jogada mais visitada
+        BattleMove Wait();
+        BattleMove Choose(const Battle& state) { Start(state); return Wait(); }
+
+        // Iteracoes somadas de todas as tarefas na ultima busca
+        uint64_t GetLastIterations() const { return lastIterations; }
+        // Rollouts evitados pela TranspositionTable na ultima busca
+        uint64_t GetLastTableHits() const { return lastTableHits; }
+        // A tabela nao pertence ao Opponent; nullptr desliga
+        void SetTable(TranspositionTable* table);
+        const OpponentSettings& GetSettings() const { return settings; }
+        void SetSettings(const OpponentSettings& settings);
+};
@@ -0,0 +1,104 @@
+#include "Player.hpp"
+#include <algorithm>
+
+Player::Player(uint64_t seed) : deck(seed), hand() {
+    handCount = 0;
+    mana = 0;
+    maxMana = 0;
+    hashSide = 0;
+    hash = ManaKey();
+}
+
+Player::Player(const Random& random) : deck(random), hand() {
+    handCount = 0;
+    mana = 0;
+    maxMana = 0;
+    hashSide = 0;
+    hash = ManaKey();
+}
+
+int Player::CountInHand(CardId id) const {
+    return (int)std::count(hand.begin(), hand.begin() + handCount, id);
+}
+
+uint64_t Player::HandKey(CardId id, int copy) const {
+    return ZobristKey(ZobristFeature::HAND, hashSide, (uint64_t)id | (uint64_t)copy << 16);
+}
+
+uint64_t Player::ManaKey() const {
+    return ZobristKey(ZobristFeature::MANA, hashSide, (uint64_t)mana | (uint64_t)maxMana << 8);
+}
+
+uint64_t Player::ComputeHash() const {
+    uint64_t result = ManaKey();
+    for (int i = 0; i < handCount; i++) {
+        // A k-esima copia de uma carta tem chave propria: a ordem na mao nao importa
+        result ^= HandKey(hand[i], (int)std::count(hand.begin(), hand.begin() + i + 1, hand[i]));
+    }
+    return result;
+}
+
+void Player::SetHashSide(int side) {
+    hashSide = (uint8_t)side;
+    hash = ComputeHash();
+}
+
+void Player::SetMana(int mana, int maxMana) {
+    hash ^= ManaKey();
+    this->mana = (uint8_t)mana;
+    this->maxMana = (uint8_t)maxMana;
+    hash ^= ManaKey();
+}
+
+int Player::Draw(int count) {
+    int drawn = 0;
+
+    for (int i = 0; i < count; i++) {
+        CardId id = deck.Draw();
+        if (id == InvalidCard) break;
+
+        if (AddToHand(id)) {
+            drawn++;
+        } else {
+            deck.Discard(id);
+        }
+    }
+
+    return drawn;
+}
+
+bool Player::AddToHand(CardId id) {
+    if (handCount >= MaxHandSize) return false;
+
+    hand[handCount++] = id;
+    hash ^= HandKey(id, CountInHand(id));
+    return true;
+}
+
+CardId Player::TakeFromHand(int index) {
+    if (index < 0 || index >= handCount) return InvalidCard;
+
+    CardId id = hand[index];
+    hash ^= HandKey(id, CountInHand(id));
+    std::copy(hand.begin() + index + 1, hand.begin() + handCount, hand.begin() + index);
+    handCount--;
+    return id;
+}
+
+void Player::ClearHand() {
+    hash ^= ComputeHash() ^ ManaKey();
+    handCount = 0;
+}
+
+void Player::StartTurn() {
+    int next = std::min<int>(maxMana + 1, MaxManaCost);
+    SetMana(next, next);
+    Draw(1);
+}
+
+bool Player::Spend(int cost) {
+    if (cost > mana) return false;
+
+    SetMana(mana - cost, maxMana);
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "Deck.hpp"
+#include "Zobrist.hpp"
+
+/*
+    Um lado da batalha fora do tabuleiro: baralho, mao e mana.
+    Capacidade fixa, como o Deck: copiar um Player e tirar um snapshot.
+    O hash cobre mao (como conjunto) e mana; o baralho e informacao escondida e fica de fora.
+*/
+class Player {
+    public:
+        static constexpr int MaxHandSize = 10;
+    private:
+        Deck deck;
+        std::array<CardId, MaxHandSize> hand;
+        uint8_t handCount;
+        uint8_t mana;
+        uint8_t maxMana;
+
+        uint8_t hashSide;
+        uint64_t hash;
+
+        int CountInHand(CardId id) const;
+        uint64_t HandKey(CardId id, int copy) const;
+        uint64_t ManaKey() const;
+    public:
+        explicit Player(uint64_t seed = 0);
+        explicit Player(const Random& random);
+
+        Deck& GetDeck() { return deck; }
+        const Deck& GetDeck() const { return deck; }
+
+        // Com a mao cheia a carta comprada vai direto para o descarte; retorna quantas entraram na mao
+        int Draw(int count);
+        bool AddToHand(CardId id);
+        // Tira a carta da mao mantendo a ordem das outras; InvalidCard se o indice nao existe
+        CardId TakeFromHand(int index);
+        void ClearHand();
+        CardId GetHandCard(int index) const { return index < handCount ? hand[index] : InvalidCard; }
+        int GetHandSize() const { return handCount; }
+
+        // Inicio do turno: +1 de mana maxima (ate MaxManaCost), mana cheia e uma compra
+        void StartTurn();
+        bool Spend(int cost);
+        int GetMana() const { return mana; }
+        int GetMaxMana() const { return maxMana; }
+        void SetMana(int mana, int maxMana);
+
+        // Lado no hash; sem isso dois jogadores com a mesma mao se anulariam no XOR
+        void SetHashSide(int side);
+        uint64_t GetHash() const { return hash; }
+        uint64_t ComputeHash() const;
+};
+
+static_assert(std::is_trivially_copyable_v<Player>, "Player e copiado como snapshot");
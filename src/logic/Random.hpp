@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*
+    xoshiro256** semeado por SplitMix64. Mesma semente, mesma sequencia em
+    qualquer plataforma: replays, a busca do oponente e simulacoes de balanceamento
+    dependem disso. O estado e so quatro inteiros; copiar o gerador e tirar um snapshot.
+*/
+class Random {
+    public:
+        using State = std::array<uint64_t, 4>;
+    private:
+        State s;
+
+        static constexpr uint64_t Rotl(uint64_t x, int k) {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        static constexpr uint64_t SplitMix(uint64_t& x) {
+            uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        }
+    public:
+        constexpr explicit Random(uint64_t seed = 0) : s() { Seed(seed); }
+
+        constexpr void Seed(uint64_t seed) {
+            // SplitMix nunca gera quatro zeros seguidos: o estado proibido nao aparece
+            for (auto& word : s) word = SplitMix(seed);
+        }
+
+        constexpr uint64_t Next() {
+            uint64_t result = Rotl(s[1] * 5, 7) * 9;
+            uint64_t t = s[1] << 17;
+
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = Rotl(s[3], 45);
+
+            return result;
+        }
+
+        // [0, bound) sem divisao nem laco de rejeicao; vies de bound / 2^32, irrelevante para baralhos
+        constexpr uint32_t Below(uint32_t bound) {
+            return (uint32_t)(((Next() >> 32) * bound) >> 32);
+        }
+
+        // [min, max], inclusivo
+        constexpr int Range(int min, int max) {
+            return min + (int)Below((uint32_t)(max - min + 1));
+        }
+
+        // Avanca 2^128 passos: equivale a 2^128 chamadas de Next()
+        constexpr void Jump() {
+            constexpr uint64_t JumpTable[] = {
+                0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+                0xa9582618e03fc9aaull, 0x39abdc4529b1661cull
+            };
+
+            State next = {};
+            for (uint64_t word : JumpTable) {
+                for (int bit = 0; bit < 64; bit++) {
+                    if (word & (1ull << bit)) {
+                        for (size_t i = 0; i < next.size(); i++) next[i] ^= s[i];
+                    }
+                    Next();
+                }
+            }
+            s = next;
+        }
+
+        /*
+            Gerador filho com sequencia propria: fica com o estado atual e este
+            salta 2^128 passos. Filhos sucessivos nunca se sobrepoem, e o que um
+            deles sorteia nao muda o que o pai ou os irmaos sorteiam depois.
+        */
+        constexpr Random Split() {
+            Random child = *this;
+            Jump();
+            return child;
+        }
+
+        constexpr const State& GetState() const { return s; }
+        constexpr void SetState(const State& state) { s = state; }
+
+        constexpr bool operator==(const Random& other) const = default;
+};
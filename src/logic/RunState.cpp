@@ -0,0 +1,200 @@
+#include "RunState.hpp"
+#include <algorithm>
+#include <utility>
+#include "BaseCards.hpp"
+#include "BitStream.hpp"
+
+static constexpr int FloorBits = 5;
+static constexpr int WidthBits = 4;
+static constexpr int PathsBits = 8;
+static constexpr int PathLengthBits = 5;
+static constexpr int ColumnBits = 3;
+static constexpr int HealthBits = 12;
+static constexpr int DeckSizeBits = 7;
+
+static_assert(Tower::MaxFloors < (1 << FloorBits) && Tower::MaxWidth <= (1 << ColumnBits) &&
+              Tower::MaxWidth < (1 << WidthBits) && Tower::MaxFloors + 1 < (1 << PathLengthBits),
+              "campos da torre no save sao estreitos demais");
+static_assert(RunState::MaxHealth < (1 << HealthBits) && RunState::MaxDeckSize < (1 << DeckSizeBits),
+              "campos do save sao estreitos demais");
+
+static uint32_t Checksum(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+RunState::RunState() : seed(0), random(0), deck() {
+    health = StartingHealth;
+    maxHealth = StartingHealth;
+    deckSize = 0;
+}
+
+bool RunState::Start(uint64_t seed, const TowerCacheFile* cache) {
+    constexpr std::pair<CardId, int> starter[] = {
+        { BaseCardId("Guerreiro"), 4 },
+        { BaseCardId("Escudeiro"), 2 },
+        { BaseCardId("Lobo"), 2 },
+        { BaseCardId("Bola de Fogo"), 1 },
+        { BaseCardId("Cura"), 1 },
+        { BaseCardId("Chamado da Matilha"), 1 }
+    };
+
+    this->seed = seed;
+    // O mapa usa a mesma semente; o salto poe o gerador da partida longe da sequencia dele
+    random.Seed(seed);
+    random.Jump();
+    health = StartingHealth;
+    maxHealth = StartingHealth;
+
+    deckSize = 0;
+    for (auto [id, copies] : starter) {
+        CardInstance card;
+        card.id = id;
+        for (int i = 0; i < copies; i++) AddCard(card);
+    }
+
+    return tower.Start(seed, cache);
+}
+
+void RunState::SetHealth(int health) {
+    this->health = (int16_t)std::clamp(health, 0, (int)maxHealth);
+}
+
+void RunState::SetMaxHealth(int maxHealth) {
+    this->maxHealth = (int16_t)std::clamp(maxHealth, 1, MaxHealth);
+    health = std::min(health, this->maxHealth);
+}
+
+bool RunState::AddCard(const CardInstance& card) {
+    if (deckSize >= MaxDeckSize) return false;
+
+    deck[deckSize++] = card;
+    return true;
+}
+
+bool RunState::RemoveCard(int index) {
+    if (index < 0 || index >= deckSize) return false;
+
+    std::copy(deck.begin() + index + 1, deck.begin() + deckSize, deck.begin() + index);
+    deckSize--;
+    return true;
+}
+
+void RunState::Serialize(std::vector<uint8_t>& out) const {
+    size_t begin = out.size();
+    BitWriter writer(out);
+
+    writer.Write(RunSaveMagic, 32);
+    writer.Write(RunSaveVersion, 16);
+    writer.Write(Tower::GeneratorVersion, 16);
+    writer.Write64(seed);
+    for (uint64_t word : random.GetState()) writer.Write64(word);
+
+    const TowerSettings& settings = tower.GetSettings();
+    writer.Write(settings.floors, FloorBits);
+    writer.Write(settings.width, WidthBits);
+    writer.Write(settings.paths, PathsBits);
+    writer.Write(tower.GetPathLength(), PathLengthBits);
+    for (int i = 0; i < tower.GetPathLength(); i++) {
+        writer.Write(tower.GetTower().GetRoom(tower.GetPathRoom(i)).column, ColumnBits);
+    }
+
+    writer.Write((uint32_t)health, HealthBits);
+    writer.Write((uint32_t)maxHealth, HealthBits);
+
+    writer.Write(deckSize, DeckSizeBits);
+    for (int i = 0; i < deckSize; i++) {
+        const CardInstance& card = deck[i];
+        writer.Write(card.id, 16);
+
+        bool modified = card.costModifier || card.attackModifier || card.healthModifier || card.flags;
+        writer.Write(modified, 1);
+        if (modified) {
+            writer.Write((uint8_t)card.costModifier, 8);
+            writer.Write((uint8_t)card.attackModifier, 8);
+            writer.Write((uint8_t)card.healthModifier, 8);
+            writer.Write(card.flags, 8);
+        }
+    }
+
+    writer.Align();
+    writer.Write(Checksum(out.data() + begin, out.size() - begin), 32);
+}
+
+bool RunState::Deserialize(const uint8_t* data, size_t size, const CardDatabase& database) {
+    // Checksum primeiro: um arquivo truncado ou corrompido nem chega a gerar o mapa
+    if (size < 4) return false;
+    size_t payload = size - 4;
+    if (BitReader(data + payload, 4).Read(32) != Checksum(data, payload)) return false;
+
+    BitReader reader(data, payload);
+    if (reader.Read(32) != RunSaveMagic || reader.Read(16) != RunSaveVersion) return false;
+    if (reader.Read(16) != Tower::GeneratorVersion) return false;
+
+    RunState loaded;
+    loaded.seed = reader.Read64();
+
+    Random::State state;
+    for (uint64_t& word : state) word = reader.Read64();
+    // Estado todo zero trava o xoshiro
+    if (state == Random::State{}) return false;
+    loaded.random.SetState(state);
+
+    TowerSettings settings;
+    settings.floors = (uint8_t)reader.Read(FloorBits);
+    settings.width = (uint8_t)reader.Read(WidthBits);
+    settings.paths = (uint8_t)reader.Read(PathsBits);
+    if (reader.Failed() || !Tower::IsValid(settings)) return false;
+
+    // Refaz o caminho no mapa da semente: cada coluna precisa ser uma das escolhas da sala anterior
+    loaded.tower = TowerManager(settings);
+    if (!loaded.tower.Start(loaded.seed)) return false;
+
+    int pathLength = (int)reader.Read(PathLengthBits);
+    for (int i = 0; i < pathLength; i++) {
+        int column = (int)reader.Read(ColumnBits);
+
+        int choice = 0;
+        const Tower& map = loaded.tower.GetTower();
+        while (choice < loaded.tower.GetChoiceCount() && map.GetRoom(loaded.tower.GetChoice(choice)).column != column) choice++;
+        if (!loaded.tower.Advance(choice)) return false;
+    }
+
+    loaded.health = (int16_t)reader.Read(HealthBits);
+    loaded.maxHealth = (int16_t)reader.Read(HealthBits);
+    if (loaded.maxHealth < 1 || loaded.health > loaded.maxHealth) return false;
+
+    int count = (int)reader.Read(DeckSizeBits);
+    if (count > MaxDeckSize) return false;
+    for (int i = 0; i < count; i++) {
+        CardInstance card;
+        card.id = (CardId)reader.Read(16);
+        if (reader.Read(1)) {
+            card.costModifier = (int8_t)reader.Read(8);
+            card.attackModifier = (int8_t)reader.Read(8);
+            card.healthModifier = (int8_t)reader.Read(8);
+            card.flags = (uint8_t)reader.Read(8);
+        }
+        if (!database.IsValid(card.id)) return false;
+        loaded.AddCard(card);
+    }
+
+    reader.Align();
+    if (reader.Failed() || reader.GetPosition() != payload) return false;
+
+    *this = loaded;
+    return true;
+}
+
+bool RunState::operator==(const RunState& other) const {
+    return seed == other.seed && random == other.random && tower == other.tower &&
+        health == other.health && maxHealth == other.maxHealth && deckSize == other.deckSize &&
+        std::equal(deck.begin(), deck.begin() + deckSize, other.deck.begin(),
+                   [](const CardInstance& a, const CardInstance& b) {
+                       return a.id == b.id && a.costModifier == b.costModifier && a.attackModifier == b.attackModifier &&
+                           a.healthModifier == b.healthModifier && a.flags == b.flags;
+                   });
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "CardDatabase.hpp"
+#include "Deck.hpp"
+#include "Random.hpp"
+#include "TowerManager.hpp"
+
+/*
+    Formato salvo de um RunState; campos em bits, na ordem abaixo (veja BitStream):
+        'ARUN'                  32
+        versao                  16
+        versao do Tower         16 (Tower::GeneratorVersion)
+        semente                 64
+        gerador                 4 x 64
+        torre                   andares 5, colunas 4, caminhos 8
+        caminho                 tamanho 5, depois a coluna de cada sala 3 (o andar e a posicao)
+        vida, vida maxima       12 + 12
+        baralho                 tamanho 7; por carta: id 16, 1 bit 'modificada' e,
+                                se for, custo 8, ataque 8, vida 8, flags 8
+        FNV-1a dos bytes acima  32, alinhado ao byte
+    O mapa nao vai para o arquivo: sai de novo da semente, e o caminho e refeito
+    sala por sala, o que tambem confere que ele existe no mapa. Por isso o save
+    guarda a versao do gerador: com outro algoritmo a mesma semente daria outro
+    mapa, e o caminho seria refeito numa torre diferente. Save assim e recusado.
+*/
+static constexpr uint32_t RunSaveMagic = 0x4e555241;   // 'ARUN'
+static constexpr uint32_t RunSaveVersion = 2;
+
+/*
+    O que dura uma subida inteira, entre as batalhas: mapa e caminho, baralho,
+    vida do heroi e o gerador da partida. Capacidade fixa e sem ponteiros:
+    copiar um RunState e tirar um snapshot (busca, desfazer); Serialize e
+    Deserialize levam microssegundos.
+*/
+class RunState {
+    public:
+        static constexpr int MaxDeckSize = Deck::Capacity;
+        static constexpr int StartingHealth = 30;
+        // Limite do campo de 12 bits
+        static constexpr int MaxHealth = 4095;
+    private:
+        uint64_t seed;
+        Random random;
+        TowerManager tower;
+        int16_t health;
+        int16_t maxHealth;
+        uint8_t deckSize;
+        std::array<CardInstance, MaxDeckSize> deck;
+    public:
+        RunState();
+
+        // Nova subida: mapa da semente, baralho inicial e vida cheia
+        bool Start(uint64_t seed, const TowerCacheFile* cache = nullptr);
+
+        uint64_t GetSeed() const { return seed; }
+        // Gerador da partida (recompensas, sementes das batalhas); vai junto no save
+        Random& GetRandom() { return random; }
+        const Random& GetRandom() const { return random; }
+        TowerManager& GetTower() { return tower; }
+        const TowerManager& GetTower() const { return tower; }
+
+        int GetHealth() const { return health; }
+        int GetMaxHealth() const { return maxHealth; }
+        // Limitada a [0, vida maxima]
+        void SetHealth(int health);
+        // Limitada a [1, MaxHealth]; a vida atual acompanha se passar
+        void SetMaxHealth(int maxHealth);
+
+        int GetDeckSize() const { return deckSize; }
+        const CardInstance& GetCard(int index) const { return deck[index]; }
+        bool AddCard(const CardInstance& card);
+        bool RemoveCard(int index);
+        void ClearDeck() { deckSize = 0; }
+
+        // Acrescenta o estado ao buffer no formato acima
+        void Serialize(std::vector<uint8_t>& out) const;
+        // Tudo ou nada: se algo nao confere (versao, checksum, caminho, cartas), o estado nao muda
+        bool Deserialize(const uint8_t* data, size_t size, const CardDatabase& database);
+
+        bool operator==(const RunState& other) const;
+};
+
+static_assert(std::is_trivially_copyable_v<RunState>, "RunState e copiado como snapshot");
@@ -0,0 +1,266 @@
+#include "Tower.hpp"
+#include <algorithm>
+
+// Saidas de uma casa da grade durante a geracao: o passo -1, 0 ou +1 vira o bit LinkLeft << (passo + 1)
+static constexpr uint8_t LinkLeft = 1;
+static constexpr uint8_t LinkRight = 4;
+
+struct RoomWeight {
+    RoomType type;
+    uint32_t weight;
+};
+
+// Sorteio dos andares sem tipo fixo
+static constexpr RoomWeight RoomWeights[] = {
+    { RoomType::BATTLE, 60 },
+    { RoomType::ELITE, 20 },
+    { RoomType::REST, 15 },
+    { RoomType::TREASURE, 5 }
+};
+
+Tower::Tower() : rooms(), edges(), stats() {
+    Clear();
+}
+
+void Tower::Clear() {
+    seed = 0;
+    settings = TowerSettings();
+    roomCount = 0;
+    edgeCount = 0;
+    floorStart.fill(0);
+    edgeStart.fill(0);
+}
+
+bool Tower::IsValid(const TowerSettings& settings) {
+    return settings.floors >= 3 && settings.floors <= MaxFloors &&
+        settings.width >= 1 && settings.width <= MaxWidth && settings.paths >= 1;
+}
+
+bool Tower::Generate(uint64_t seed, const TowerSettings& settings) {
+    Clear();
+    if (!IsValid(settings)) return false;
+
+    this->seed = seed;
+    this->settings = settings;
+
+    Random random(seed);
+    const int floors = settings.floors;
+    const int width = settings.width;
+
+    uint8_t links[MaxFloors][MaxWidth] = {};
+    bool used[MaxFloors][MaxWidth] = {};
+
+    // Caminhos de baixo para cima; os dois primeiros comecam em colunas diferentes
+    int firstColumn = -1;
+    for (int path = 0; path < settings.paths; path++) {
+        int column = (int)random.Below(width);
+        while (path == 1 && width > 1 && column == firstColumn) column = (int)random.Below(width);
+        if (path == 0) firstColumn = column;
+
+        for (int floor = 0; floor < floors - 1; floor++) {
+            used[floor][column] = true;
+
+            int low = column > 0 ? -1 : 0;
+            int high = column < width - 1 ? 1 : 0;
+            int step = low + (int)random.Below(high - low + 1);
+
+            // Nao cruza a saida da casa vizinha que vai no sentido contrario; subir reto nunca cruza
+            if (step < 0 && (links[floor][column - 1] & LinkRight)) step = 0;
+            if (step > 0 && (links[floor][column + 1] & LinkLeft)) step = 0;
+
+            links[floor][column] |= (uint8_t)(LinkLeft << (step + 1));
+            column += step;
+        }
+        used[floors - 1][column] = true;
+    }
+
+    uint8_t index[MaxFloors][MaxWidth];
+    for (int floor = 0; floor < floors; floor++) {
+        floorStart[floor] = roomCount;
+        for (int column = 0; column < width; column++) {
+            if (!used[floor][column]) continue;
+            index[floor][column] = roomCount;
+            rooms[roomCount++] = { (uint8_t)floor, (uint8_t)column, RoomType::BATTLE, 0 };
+        }
+    }
+
+    const uint8_t boss = roomCount;
+    floorStart[floors] = boss;
+    rooms[roomCount++] = { (uint8_t)floors, (uint8_t)(width / 2), RoomType::BOSS, 0 };
+    floorStart[floors + 1] = roomCount;
+
+    // Filhos em ordem de coluna; o ultimo andar inteiro leva ao chefe
+    for (int room = 0; room < boss; room++) {
+        TowerRoom& current = rooms[room];
+        edgeStart[room] = edgeCount;
+
+        if (current.floor == floors - 1) {
+            edges[edgeCount++] = boss;
+        } else {
+            for (int step = -1; step <= 1; step++) {
+                if (links[current.floor][current.column] & (LinkLeft << (step + 1))) {
+                    edges[edgeCount++] = index[current.floor + 1][current.column + step];
+                }
+            }
+        }
+        current.childCount = (uint8_t)(edgeCount - edgeStart[room]);
+    }
+    edgeStart[boss] = edgeCount;
+    edgeStart[boss + 1] = edgeCount;
+
+    AssignTypes(random);
+    Analyze();
+    return true;
+}
+
+void Tower::AssignTypes(Random& random) {
+    const int floors = settings.floors;
+    // Elites e descansos so depois do primeiro terco, como nas torres classicas
+    const int firstSpecial = floors / 3;
+
+    // Tipos dos pais de cada sala, um bit por tipo; as salas vem em ordem de andar, os pais sao sorteados antes
+    uint8_t parentTypes[MaxRooms] = {};
+
+    for (int room = 0; room < GetBoss(); room++) {
+        int floor = rooms[room].floor;
+        RoomType type = RoomType::BATTLE;
+
+        if (floor == floors - 1) {
+            type = RoomType::REST;
+        } else if (floor == floors / 2) {
+            type = RoomType::TREASURE;
+        } else if (floor > 0) {
+            // Nada alem de batalha aparece duas vezes seguidas num caminho; descanso logo antes do andar de descanso tambem nao
+            uint32_t weights[std::size(RoomWeights)];
+            uint32_t total = 0;
+            for (size_t i = 0; i < std::size(RoomWeights); i++) {
+                RoomType candidate = RoomWeights[i].type;
+                bool allowed = candidate == RoomType::BATTLE ||
+                    (!(parentTypes[room] & (1 << (int)candidate)) &&
+                     (candidate == RoomType::TREASURE || floor >= firstSpecial) &&
+                     (candidate != RoomType::REST || floor < floors - 2));
+                weights[i] = allowed ? RoomWeights[i].weight : 0;
+                total += weights[i];
+            }
+
+            uint32_t roll = random.Below(total);
+            size_t chosen = 0;
+            while (roll >= weights[chosen]) roll -= weights[chosen++];
+            type = RoomWeights[chosen].type;
+        }
+
+        rooms[room].type = type;
+        const uint8_t* children = GetChildren(room);
+        for (int i = 0; i < GetChildCount(room); i++) {
+            parentTypes[children[i]] |= (uint8_t)(1 << (int)type);
+        }
+    }
+}
+
+void Tower::Analyze() {
+    // As salas estao ordenadas por andar: os filhos sempre vem depois do pai
+    for (int room = roomCount - 1; room >= 0; room--) {
+        TowerPathStats result = { 1, 0, 0, 0, 0 };
+
+        if (GetChildCount(room) > 0) {
+            result = { 0, UINT8_MAX, 0, UINT8_MAX, 0 };
+
+            const uint8_t* children = GetChildren(room);
+            for (int i = 0; i < GetChildCount(room); i++) {
+                const TowerPathStats& child = stats[children[i]];
+                result.paths = child.paths > UINT32_MAX - result.paths ? UINT32_MAX : result.paths + child.paths;
+                result.minElites = std::min(result.minElites, child.minElites);
+                result.maxElites = std::max(result.maxElites, child.maxElites);
+                result.minRests = std::min(result.minRests, child.minRests);
+                result.maxRests = std::max(result.maxRests, child.maxRests);
+            }
+        }
+
+        uint8_t elite = rooms[room].type == RoomType::ELITE;
+        uint8_t rest = rooms[room].type == RoomType::REST;
+        result.minElites += elite;
+        result.maxElites += elite;
+        result.minRests += rest;
+        result.maxRests += rest;
+        stats[room] = result;
+    }
+}
+
+bool Tower::Assign(uint64_t seed, const TowerSettings& settings,
+                   const TowerRoom* rooms, int roomCount, const uint8_t* edges, int edgeCount) {
+    Clear();
+    if (!IsValid(settings) || roomCount < 2 || roomCount > MaxRooms || edgeCount < 0 || edgeCount > MaxEdges) return false;
+
+    const int floors = settings.floors;
+    const int boss = roomCount - 1;
+
+    int edgeTotal = 0;
+    for (int room = 0; room < roomCount; room++) {
+        const TowerRoom& current = rooms[room];
+        bool isBoss = room == boss;
+
+        if (current.column >= settings.width || current.type > RoomType::BOSS) return false;
+        if ((current.floor == floors) != isBoss || (current.type == RoomType::BOSS) != isBoss) return false;
+        if ((current.childCount == 0) != isBoss) return false;
+
+        // Andares em sequencia, sem pular nenhum; colunas crescentes dentro do andar
+        if (room == 0 && current.floor != 0) return false;
+        if (room > 0) {
+            const TowerRoom& previous = rooms[room - 1];
+            if (current.floor != previous.floor && current.floor != previous.floor + 1) return false;
+            if (current.floor == previous.floor && current.column <= previous.column) return false;
+        }
+        edgeTotal += current.childCount;
+    }
+    if (edgeTotal != edgeCount) return false;
+
+    int edge = 0;
+    for (int room = 0; room < roomCount; room++) {
+        for (int i = 0; i < rooms[room].childCount; i++, edge++) {
+            if (edges[edge] >= roomCount || rooms[edges[edge]].floor != rooms[room].floor + 1) return false;
+        }
+    }
+
+    // Tudo confere: copia e reconstroi os indices
+    std::copy(rooms, rooms + roomCount, this->rooms.begin());
+    std::copy(edges, edges + edgeCount, this->edges.begin());
+    this->seed = seed;
+    this->settings = settings;
+    this->roomCount = (uint8_t)roomCount;
+    this->edgeCount = (uint16_t)edgeCount;
+
+    edge = 0;
+    for (int room = 0; room < roomCount; room++) {
+        edgeStart[room] = (uint16_t)edge;
+        edge += rooms[room].childCount;
+
+        if (room == 0 || rooms[room].floor != rooms[room - 1].floor) floorStart[rooms[room].floor] = (uint8_t)room;
+    }
+    edgeStart[roomCount] = (uint16_t)edge;
+    floorStart[floors + 1] = (uint8_t)roomCount;
+
+    Analyze();
+    return true;
+}
+
+TowerPathStats Tower::GetSummary() const {
+    if (roomCount == 0) return {};
+
+    TowerPathStats summary = { 0, UINT8_MAX, 0, UINT8_MAX, 0 };
+    for (int room = floorStart[0]; room < floorStart[1]; room++) {
+        const TowerPathStats& entry = stats[room];
+        summary.paths = entry.paths > UINT32_MAX - summary.paths ? UINT32_MAX : summary.paths + entry.paths;
+        summary.minElites = std::min(summary.minElites, entry.minElites);
+        summary.maxElites = std::max(summary.maxElites, entry.maxElites);
+        summary.minRests = std::min(summary.minRests, entry.minRests);
+        summary.maxRests = std::max(summary.maxRests, entry.maxRests);
+    }
+    return summary;
+}
+
+bool Tower::operator==(const Tower& other) const {
+    return seed == other.seed && settings == other.settings &&
+        roomCount == other.roomCount && edgeCount == other.edgeCount &&
+        std::equal(rooms.begin(), rooms.begin() + roomCount, other.rooms.begin()) &&
+        std::equal(edges.begin(), edges.begin() + edgeCount, other.edges.begin());
+}
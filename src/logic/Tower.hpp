@@ -0,0 +1,116 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "Random.hpp"
+
+enum class RoomType : uint8_t {
+    BATTLE,
+    ELITE,
+    REST,
+    TREASURE,
+    BOSS
+};
+
+struct TowerSettings {
+    uint8_t floors = 15;    // andares antes do chefe
+    uint8_t width = 7;      // colunas
+    uint8_t paths = 6;      // caminhos tracados de baixo para cima
+
+    bool operator==(const TowerSettings& other) const = default;
+};
+
+// Uma sala; as saidas ficam em Tower::edges (veja Tower::GetChildren)
+struct TowerRoom {
+    uint8_t floor;
+    uint8_t column;
+    RoomType type;
+    uint8_t childCount;
+
+    bool operator==(const TowerRoom& other) const = default;
+};
+
+// Caminhos que saem de uma sala ate o chefe, contando a propria sala
+struct TowerPathStats {
+    uint32_t paths;         // satura em UINT32_MAX
+    uint8_t minElites;
+    uint8_t maxElites;
+    uint8_t minRests;
+    uint8_t maxRests;
+};
+
+/*
+    Mapa da torre: um DAG em camadas, do andar 0 ao chefe, gerado a partir de uma semente.
+    O grafo fica em arrays de adjacencia compactos:
+        rooms       ordenadas por andar e coluna; o chefe e a ultima
+        edges       indices dos filhos, agrupados por sala (em ordem de coluna)
+        edgeStart   os filhos da sala i estao em [edgeStart[i], edgeStart[i + 1])
+        floorStart  as salas do andar f estao em [floorStart[f], floorStart[f + 1])
+    As metricas de caminho sao calculadas junto, numa passada do chefe para baixo.
+    A mesma semente com as mesmas configuracoes gera sempre o mesmo mapa, em
+    qualquer plataforma: GeneratorVersion muda quando o algoritmo mudar (o cache
+    de torres e o save da subida guardam a versao e recusam outra).
+*/
+class Tower {
+    public:
+        static constexpr uint32_t GeneratorVersion = 1;
+        static constexpr int MaxFloors = 16;
+        static constexpr int MaxWidth = 8;
+        static constexpr int MaxRooms = MaxFloors * MaxWidth + 1;
+        // No maximo 3 saidas por sala; o ultimo andar so liga ao chefe
+        static constexpr int MaxEdges = (MaxFloors - 1) * MaxWidth * 3 + MaxWidth;
+    private:
+        uint64_t seed;
+        TowerSettings settings;
+        uint8_t roomCount;
+        uint16_t edgeCount;
+        std::array<uint8_t, MaxFloors + 2> floorStart;
+        std::array<TowerRoom, MaxRooms> rooms;
+        std::array<uint16_t, MaxRooms + 1> edgeStart;
+        std::array<uint8_t, MaxEdges> edges;
+        std::array<TowerPathStats, MaxRooms> stats;
+
+        void AssignTypes(Random& random);
+        void Analyze();
+    public:
+        Tower();
+
+        static bool IsValid(const TowerSettings& settings);
+
+        // false (e mapa vazio) se as configuracoes passam dos limites
+        bool Generate(uint64_t seed, const TowerSettings& settings);
+        /*
+            Monta o mapa a partir das salas e saidas ja geradas (lidas do cache).
+            Confere a estrutura inteira; se algo nao fecha, devolve false e o mapa fica vazio.
+        */
+        bool Assign(uint64_t seed, const TowerSettings& settings,
+                    const TowerRoom* rooms, int roomCount, const uint8_t* edges, int edgeCount);
+        void Clear();
+
+        uint64_t GetSeed() const { return seed; }
+        const TowerSettings& GetSettings() const { return settings; }
+        int GetRoomCount() const { return roomCount; }
+        int GetEdgeCount() const { return edgeCount; }
+        const TowerRoom& GetRoom(int room) const { return rooms[room]; }
+        const TowerPathStats& GetStats(int room) const { return stats[room]; }
+        int GetBoss() const { return roomCount - 1; }
+
+        int GetFloorBegin(int floor) const { return floorStart[floor]; }
+        int GetFloorEnd(int floor) const { return floorStart[floor + 1]; }
+
+        const uint8_t* GetChildren(int room) const { return edges.data() + edgeStart[room]; }
+        int GetChildCount(int room) const { return rooms[room].childCount; }
+
+        // Salas e saidas em sequencia, como o cache grava
+        const TowerRoom* GetRooms() const { return rooms.data(); }
+        const uint8_t* GetEdges() const { return edges.data(); }
+
+        // Metricas de todos os caminhos, somadas sobre as salas de entrada
+        TowerPathStats GetSummary() const;
+
+        // So compara a parte usada dos arrays
+        bool operator==(const Tower& other) const;
+};
+
+static_assert(std::is_trivially_copyable_v<Tower>, "Tower e copiado como snapshot");
+static_assert(Tower::MaxRooms <= 255 && Tower::MaxEdges <= UINT16_MAX, "indices de sala cabem em uint8_t");
@@ -0,0 +1,149 @@
+#include "TowerCache.hpp"
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+
+TowerCacheFile::TowerCacheFile() {
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    entries = nullptr;
+    maps = nullptr;
+}
+
+TowerCacheFile::~TowerCacheFile() {
+    Close();
+}
+
+bool TowerCacheFile::Open(const std::string& path) {
+    Close();
+    if (!file.Open(path)) return false;
+
+    data = file.GetData();
+    size = file.GetSize();
+
+    if (size < sizeof(TowerCacheHeader) || !Validate()) {
+        std::cerr << "Cache de mapas invalido ou de outro gerador: " << path << std::endl;
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool TowerCacheFile::Validate() {
+    header = (const TowerCacheHeader*)data;
+    if (memcmp(header->magic, TowerCacheMagic, sizeof(TowerCacheMagic)) != 0 || header->version != TowerCacheVersion) return false;
+    if (header->generator != Tower::GeneratorVersion || !Tower::IsValid(GetSettings())) return false;
+
+    const uint64_t entriesSize = (uint64_t)header->count * sizeof(TowerCacheEntry);
+    if (header->entriesOffset % alignof(TowerCacheEntry) != 0) return false;
+    if (header->entriesOffset > size || entriesSize > size - header->entriesOffset) return false;
+    if (header->dataOffset > size || header->dataSize > size - header->dataOffset) return false;
+
+    entries = (const TowerCacheEntry*)(data + header->entriesOffset);
+    maps = data + header->dataOffset;
+
+    // Limites conferidos uma vez; a estrutura de cada mapa e conferida por Tower::Assign ao carregar
+    for (uint32_t i = 0; i < header->count; i++) {
+        const TowerCacheEntry& entry = entries[i];
+        uint64_t mapSize = (uint64_t)entry.roomCount * sizeof(TowerRoom) + entry.edgeCount;
+        if ((uint64_t)entry.offset + mapSize > header->dataSize) return false;
+        if (i > 0 && entries[i - 1].seed >= entry.seed) return false;
+    }
+    return true;
+}
+
+void TowerCacheFile::Close() {
+    file.Close();
+    data = nullptr;
+    size = 0;
+    header = nullptr;
+    entries = nullptr;
+    maps = nullptr;
+}
+
+TowerSettings TowerCacheFile::GetSettings() const {
+    TowerSettings settings;
+    if (header) {
+        settings.floors = header->floors;
+        settings.width = header->width;
+        settings.paths = header->paths;
+    }
+    return settings;
+}
+
+bool TowerCacheFile::Get(uint32_t index, Tower& out) const {
+    if (index >= GetCount()) {
+        out.Clear();
+        return false;
+    }
+
+    const TowerCacheEntry& entry = entries[index];
+    const TowerRoom* rooms = (const TowerRoom*)(maps + entry.offset);
+    const uint8_t* edges = maps + entry.offset + entry.roomCount * sizeof(TowerRoom);
+    return out.Assign(entry.seed, GetSettings(), rooms, entry.roomCount, edges, entry.edgeCount);
+}
+
+bool TowerCacheFile::Find(uint64_t seed, Tower& out) const {
+    const TowerCacheEntry* end = entries + GetCount();
+    const TowerCacheEntry* found = std::lower_bound(entries, end, seed,
+        [](const TowerCacheEntry& entry, uint64_t seed) { return entry.seed < seed; });
+
+    if (found == end || found->seed != seed) {
+        out.Clear();
+        return false;
+    }
+    return Get((uint32_t)(found - entries), out);
+}
+
+TowerCacheWriter::TowerCacheWriter(const TowerSettings& settings) : settings(settings) {
+}
+
+bool TowerCacheWriter::Add(const Tower& tower) {
+    if (tower.GetRoomCount() == 0 || tower.GetSettings() != settings) {
+        std::cerr << "Mapa vazio ou de outras configuracoes: semente " << tower.GetSeed() << std::endl;
+        return false;
+    }
+    if (!entries.empty() && entries.back().seed >= tower.GetSeed()) {
+        std::cerr << "Sementes fora de ordem: " << tower.GetSeed() << " depois de " << entries.back().seed << std::endl;
+        return false;
+    }
+
+    size_t roomBytes = tower.GetRoomCount() * sizeof(TowerRoom);
+    if (maps.size() + roomBytes + tower.GetEdgeCount() > UINT32_MAX) {
+        std::cerr << "Cache de mapas passou de 4 GB" << std::endl;
+        return false;
+    }
+
+    TowerCacheEntry entry = {};
+    entry.seed = tower.GetSeed();
+    entry.offset = (uint32_t)maps.size();
+    entry.roomCount = (uint8_t)tower.GetRoomCount();
+    entry.edgeCount = (uint16_t)tower.GetEdgeCount();
+    entries.push_back(entry);
+
+    const uint8_t* rooms = (const uint8_t*)tower.GetRooms();
+    maps.insert(maps.end(), rooms, rooms + roomBytes);
+    maps.insert(maps.end(), tower.GetEdges(), tower.GetEdges() + tower.GetEdgeCount());
+    return true;
+}
+
+bool TowerCacheWriter::Write(const std::string& path) const {
+    TowerCacheHeader header = {};
+    memcpy(header.magic, TowerCacheMagic, sizeof(TowerCacheMagic));
+    header.version = TowerCacheVersion;
+    header.generator = Tower::GeneratorVersion;
+    header.floors = settings.floors;
+    header.width = settings.width;
+    header.paths = settings.paths;
+    header.count = (uint32_t)entries.size();
+    header.entriesOffset = sizeof(TowerCacheHeader);
+    header.dataOffset = header.entriesOffset + (uint32_t)(entries.size() * sizeof(TowerCacheEntry));
+    header.dataSize = (uint32_t)maps.size();
+
+    std::vector<uint8_t> bytes(header.dataOffset + maps.size());
+    memcpy(bytes.data(), &header, sizeof(header));
+    memcpy(bytes.data() + header.entriesOffset, entries.data(), entries.size() * sizeof(TowerCacheEntry));
+    memcpy(bytes.data() + header.dataOffset, maps.data(), maps.size());
+    return WriteFileAtomic(path, bytes);
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Tower.hpp"
+#include "../core/MappedFile.hpp"
+
+/*
+    Cache em disco de mapas gerados (little-endian), para rodadas de
+    balanceamento que passam pelas mesmas sementes varias vezes:
+        TowerCacheHeader
+        TowerCacheEntry[count], ordenado por semente (crescente, sem repeticao)
+        dados: de cada mapa, TowerRoom[roomCount] seguido de uint8_t[edgeCount]
+    So o grafo vai para o disco; as metricas de caminho sao refeitas ao carregar.
+    O cabecalho guarda as configuracoes e a versao do gerador: um cache de outro
+    gerador e recusado, e quem o usa gera os mapas de novo.
+*/
+static constexpr char TowerCacheMagic[4] = { 'A', 'T', 'W', 'R' };
+static constexpr uint32_t TowerCacheVersion = 1;
+
+struct TowerCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t generator;
+    uint8_t floors;
+    uint8_t width;
+    uint8_t paths;
+    uint8_t reserved;
+    uint32_t count;
+    uint32_t entriesOffset;
+    uint32_t dataOffset;
+    uint32_t dataSize;
+};
+
+struct TowerCacheEntry {
+    uint64_t seed;
+    uint32_t offset;        // a partir de dataOffset
+    uint8_t roomCount;
+    uint8_t reserved;
+    uint16_t edgeCount;
+};
+
+static_assert(sizeof(TowerCacheHeader) == 32 && sizeof(TowerCacheEntry) == 16 && sizeof(TowerRoom) == 4,
+              "layout do cache de mapas mudou");
+
+// Leitor de um cache de mapas mapeado em memoria
+class TowerCacheFile {
+    private:
+        MappedFile file;
+        const uint8_t* data;
+        size_t size;
+        const TowerCacheHeader* header;
+        const TowerCacheEntry* entries;
+        const uint8_t* maps;
+
+        bool Validate();
+    public:
+        TowerCacheFile();
+        ~TowerCacheFile();
+
+        TowerCacheFile(const TowerCacheFile&) = delete;
+        TowerCacheFile& operator=(const TowerCacheFile&) = delete;
+
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return file.IsOpen(); }
+
+        uint32_t GetCount() const { return header ? header->count : 0; }
+        TowerSettings GetSettings() const;
+        uint64_t GetSeed(uint32_t index) const { return entries[index].seed; }
+
+        // false se o mapa gravado nao fecha (Tower::Assign); 'out' fica vazio
+        bool Get(uint32_t index, Tower& out) const;
+        // Busca binaria pela semente; false se ela nao esta no cache
+        bool Find(uint64_t seed, Tower& out) const;
+};
+
+// Monta um cache de mapas; grava com WriteFileAtomic, como o CardDataWriter
+class TowerCacheWriter {
+    private:
+        TowerSettings settings;
+        std::vector<TowerCacheEntry> entries;
+        std::vector<uint8_t> maps;
+    public:
+        explicit TowerCacheWriter(const TowerSettings& settings);
+
+        // As sementes precisam vir em ordem crescente, todas com as mesmas configuracoes
+        bool Add(const Tower& tower);
+        size_t Size() const { return entries.size(); }
+        bool Write(const std::string& path) const;
+};
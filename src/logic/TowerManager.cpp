@@ -0,0 +1,53 @@
+#include "TowerManager.hpp"
+#include "TowerCache.hpp"
+#include <algorithm>
+
+TowerManager::TowerManager(const TowerSettings& settings) : settings(settings), path() {
+    pathLength = 0;
+}
+
+bool TowerManager::Start(uint64_t seed, const TowerCacheFile* cache) {
+    pathLength = 0;
+
+    if (cache && cache->IsOpen() && cache->GetSettings() == settings && cache->Find(seed, tower)) {
+        return true;
+    }
+    return tower.Generate(seed, settings);
+}
+
+int TowerManager::GetChoiceCount() const {
+    if (tower.GetRoomCount() == 0) return 0;
+
+    int current = GetCurrentRoom();
+    if (current < 0) return tower.GetFloorEnd(0) - tower.GetFloorBegin(0);
+    return tower.GetChildCount(current);
+}
+
+int TowerManager::GetChoice(int index) const {
+    if (index < 0 || index >= GetChoiceCount()) return -1;
+
+    int current = GetCurrentRoom();
+    if (current < 0) return tower.GetFloorBegin(0) + index;
+    return tower.GetChildren(current)[index];
+}
+
+bool TowerManager::Advance(int choice) {
+    int room = GetChoice(choice);
+    if (room < 0) return false;
+
+    path[pathLength++] = (uint8_t)room;
+    return true;
+}
+
+bool TowerManager::WasVisited(int room) const {
+    if (room < 0 || room >= tower.GetRoomCount()) return false;
+
+    // O caminho tem uma sala por andar, na ordem dos andares
+    int floor = tower.GetRoom(room).floor;
+    return floor < pathLength && path[floor] == room;
+}
+
+bool TowerManager::operator==(const TowerManager& other) const {
+    return settings == other.settings && tower == other.tower && pathLength == other.pathLength &&
+        std::equal(path.begin(), path.begin() + pathLength, other.path.begin());
+}
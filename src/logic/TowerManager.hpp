@@ -0,0 +1,46 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "Tower.hpp"
+
+class TowerCacheFile;
+
+/*
+    Progresso de uma subida: o mapa da semente da partida e o caminho feito,
+    uma sala por andar. O mapa vem do cache quando ele tem a semente com as
+    mesmas configuracoes; senao e gerado na hora, o que leva microssegundos.
+*/
+class TowerManager {
+    private:
+        TowerSettings settings;
+        Tower tower;
+        std::array<uint8_t, Tower::MaxFloors + 1> path;
+        uint8_t pathLength;
+    public:
+        explicit TowerManager(const TowerSettings& settings = TowerSettings());
+
+        // false se as configuracoes sao invalidas
+        bool Start(uint64_t seed, const TowerCacheFile* cache = nullptr);
+
+        // Para onde se pode ir: as salas do andar 0 no inicio, depois os filhos da sala atual
+        int GetChoiceCount() const;
+        int GetChoice(int index) const;
+        // false se a escolha nao existe (nada muda)
+        bool Advance(int choice);
+
+        // -1 antes da primeira escolha
+        int GetCurrentRoom() const { return pathLength > 0 ? path[pathLength - 1] : -1; }
+        bool WasVisited(int room) const;
+        // Salas do caminho feito, do andar 0 ate a atual
+        int GetPathLength() const { return pathLength; }
+        int GetPathRoom(int index) const { return path[index]; }
+        bool IsFinished() const { return tower.GetRoomCount() > 0 && GetCurrentRoom() == tower.GetBoss(); }
+
+        const Tower& GetTower() const { return tower; }
+        const TowerSettings& GetSettings() const { return settings; }
+
+        bool operator==(const TowerManager& other) const;
+};
+
+static_assert(std::is_trivially_copyable_v<TowerManager>, "TowerManager vai junto no snapshot do RunState");
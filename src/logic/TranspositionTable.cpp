@@ -0,0 +1,83 @@
+#include "TranspositionTable.hpp"
+#include <algorithm>
+#include <cmath>
+
+TranspositionTable::TranspositionTable(size_t megabytes) {
+    size_t count = std::max<size_t>(megabytes * 1024 * 1024 / sizeof(Bucket), 1);
+    size_t power = 1;
+    while (power * 2 <= count) power *= 2;
+
+    buckets = std::make_unique<Bucket[]>(power);
+    mask = power - 1;
+    generation = 0;
+    Clear();
+}
+
+uint64_t TranspositionTable::Pack(uint32_t visits, float value, uint8_t generation) {
+    uint64_t fixed = (uint64_t)std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f);
+    return (uint64_t)visits | fixed << 32 | (uint64_t)generation << 48;
+}
+
+TranspositionEntry TranspositionTable::Unpack(uint64_t data) {
+    TranspositionEntry entry;
+    entry.visits = (uint32_t)data;
+    entry.value = (float)((data >> 32) & 0xffff) / 65535.0f;
+    return entry;
+}
+
+void TranspositionTable::Clear() {
+    for (uint64_t i = 0; i <= mask; i++) {
+        for (Slot& slot : buckets[i].slots) {
+            slot.check.store(0, std::memory_order_relaxed);
+            slot.data.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool TranspositionTable::Probe(uint64_t hash, TranspositionEntry& out) const {
+    const Bucket& bucket = buckets[hash & mask];
+
+    for (const Slot& slot : bucket.slots) {
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        uint64_t check = slot.check.load(std::memory_order_relaxed);
+        if ((check ^ data) == hash && (uint32_t)data > 0) {
+            out = Unpack(data);
+            return true;
+        }
+    }
+    return false;
+}
+
+void TranspositionTable::Store(uint64_t hash, float value) {
+    Bucket& bucket = buckets[hash & mask];
+    uint8_t current = generation.load(std::memory_order_relaxed);
+
+    // Entrada da mesma posicao, ou a de menor valor: de busca antiga primeiro, depois a menos visitada
+    Slot* target = nullptr;
+    uint64_t targetData = 0;
+    uint64_t worst = UINT64_MAX;
+    for (Slot& slot : bucket.slots) {
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        uint64_t check = slot.check.load(std::memory_order_relaxed);
+        if ((check ^ data) == hash) {
+            target = &slot;
+            targetData = data;
+            break;
+        }
+
+        uint64_t score = (uint64_t)(GenerationOf(data) == current) << 32 | (uint32_t)data;
+        if (score < worst) {
+            worst = score;
+            target = &slot;
+            targetData = 0;
+        }
+    }
+
+    TranspositionEntry entry = Unpack(targetData);
+    uint32_t visits = entry.visits < UINT32_MAX ? entry.visits + 1 : entry.visits;
+    float mean = entry.value + (value - entry.value) / visits;
+
+    uint64_t data = Pack(visits, mean, current);
+    target->data.store(data, std::memory_order_relaxed);
+    target->check.store(hash ^ data, std::memory_order_relaxed);
+}
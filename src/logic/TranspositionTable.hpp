@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Avaliacao guardada de uma posicao: media dos resultados (0..1, do ponto de vista do jogador)
+struct TranspositionEntry {
+    uint32_t visits = 0;
+    float value = 0.0f;
+};
+
+/*
+    Tabela de transposicao de tamanho fixo, compartilhada entre threads sem travas.
+    Cada balde ocupa uma linha de cache (64 bytes) com 4 entradas; a posicao cai
+    num balde pelos bits baixos do hash de Zobrist. Cada entrada guarda
+    'dados' e 'hash ^ dados' em dois atomicos relaxados: uma leitura que
+    pegar metade de uma escrita concorrente nao confere com o hash e e
+    tratada como ausente. Escritas concorrentes na mesma entrada podem perder
+    uma atualizacao; para estatisticas de busca isso so custa precisao.
+*/
+class TranspositionTable {
+    private:
+        struct Slot {
+            std::atomic<uint64_t> check;    // hash ^ data
+            std::atomic<uint64_t> data;     // visitas (32) | media em ponto fixo (16) | geracao (8)
+        };
+
+        static constexpr int SlotsPerBucket = 4;
+
+        struct alignas(64) Bucket {
+            Slot slots[SlotsPerBucket];
+        };
+
+        static_assert(sizeof(Bucket) == 64, "um balde por linha de cache");
+
+        std::unique_ptr<Bucket[]> buckets;
+        uint64_t mask;
+        std::atomic<uint8_t> generation;
+
+        static uint64_t Pack(uint32_t visits, float value, uint8_t generation);
+        static TranspositionEntry Unpack(uint64_t data);
+        static uint8_t GenerationOf(uint64_t data) { return (uint8_t)(data >> 48); }
+    public:
+        // Arredonda para baixo para uma potencia de 2 de baldes
+        explicit TranspositionTable(size_t megabytes = 16);
+
+        TranspositionTable(const TranspositionTable&) = delete;
+        TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+        bool Probe(uint64_t hash, TranspositionEntry& out) const;
+        // Soma mais um resultado a media da posicao; pode substituir a entrada menos util do balde
+        void Store(uint64_t hash, float value);
+        // Entradas de buscas anteriores passam a ser substituidas primeiro
+        void NewSearch() { generation.fetch_add(1, std::memory_order_relaxed); }
+        // Nao pode rodar junto com Probe/Store
+        void Clear();
+
+        size_t GetCapacity() const { return (size_t)(mask + 1) * SlotsPerBucket; }
+};
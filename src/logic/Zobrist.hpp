@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+
+/*
+    Chaves de Zobrist para o estado da batalha. Vida, ids de carta e mana tem
+    faixas grandes demais para tabelas sorteadas, entao a chave de cada
+    caracteristica e calculada: o tipo e os valores passam por uma mistura
+    forte (splitmix64) e viram 64 bits sem relacao com as chaves vizinhas.
+    O hash do estado e o XOR das chaves: trocar um valor e tirar a chave velha
+    e por a nova, sem olhar o resto do estado.
+*/
+enum class ZobristFeature : uint8_t {
+    LANE = 1,   // a: lado, pista, carta, status, efeito de morte; b: vida, ataque, armadura, valor do efeito
+    HERO,       // a: lado; b: vida, armadura, vida maxima
+    HAND,       // a: lado; b: carta e qual copia dela na mao (a mao conta como conjunto)
+    MANA,       // a: lado; b: mana e mana maxima
+    TURN        // a: turno; b: lado da vez
+};
+
+constexpr uint64_t ZobristMix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+constexpr uint64_t ZobristKey(ZobristFeature feature, uint64_t a, uint64_t b = 0) {
+    // A primeira mistura e constante para cada tipo: o compilador a resolve
+    return ZobristMix(ZobristMix(ZobristMix((uint64_t)feature) ^ a) ^ b);
+}
@@ -1,12 +1,48 @@
 #include "core/GameManager.hpp"
+#include <cstring>
+#include <cstdlib>
 
 int main(int argc, char* argv[]) {
     GameManager* game = new GameManager();
 
+    bool headless = false;
+    Uint64 headlessTicks = 100000;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            // --headless [passos]: simula sem janela, o mais rapido possivel
+            headless = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                headlessTicks = std::strtoull(argv[++i], nullptr, 10);
+            }
+        } else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            // --fps N: limite de quadros por segundo (0 = sem limite)
+            game->GetFramePacer().SetTargetFps(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--idle") == 0) {
+            // --idle: nao redesenha quando nada mudou
+            game->GetFramePacer().SetIdleMode(true);
+        } else if (std::strcmp(argv[i], "--face-cache") == 0 && i + 1 < argc) {
+            // --face-cache MB: memoria das paginas de faces de carta de cada cena (padrao 32)
+            game->GetScenes().SetCardFaceBudget((size_t)std::strtoull(argv[++i], nullptr, 10) * 1024 * 1024);
+        } else if (std::strcmp(argv[i], "--dirty-rects") == 0) {
+            // --dirty-rects: redesenha so as areas da tela que mudaram
+            game->SetDirtyRegions(true);
+        }
+    }
+
+    if (headless) {
+        if (game->InitializeHeadless()) {
+            game->RunHeadless(headlessTicks);
+        }
+
+        delete game;
+        return 0;
+    }
+
     if(game->Initialize("Apex Ascent", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 1280, 720, false)) {
         game->Run();
     }
 
     delete game;
     return 0;
-}
\ No newline at end of file
+}
@@ -1,26 +1,65 @@
 #include "Card.hpp"
+#include "../core/EntitySystems.hpp"
 
-Card::Card(std::string name, CardType type, int manaCost, int x, int y)
-    : DynamicObject(x, y, 120, 180), name(name), type(type), manaCost(manaCost) {
+Card::Card(EntityStore& store, const CardDatabase& database, EntityHandle handle)
+    : store(store), database(database), handle(handle) {
 }
 
 Card::~Card() {}
 
-void Card::Initialize() {}
+// Devolvida para handles mortos: nome vazio, custo 0
+static const CardDefinition NoDefinition;
 
-void Card::Update(float dt) {}
+CardId Card::GetId() const {
+    uint32_t dense = store.DenseIndex(handle);
+    if (dense == EntityStore::InvalidIndex) return InvalidCard;
+
+    return store.card[dense].id;
+}
+
+const CardDefinition& Card::GetDefinition() const {
+    CardId id = GetId();
+    if (!database.IsValid(id)) return NoDefinition;
+
+    return database.Get(id);
+}
+
+std::string_view Card::GetName() const {
+    return GetDefinition().name;
+}
 
-void Card::Render(SDL_Renderer* renderer) {
-    SDL_Rect rect = { x, y, width, height };
+CardType Card::GetType() const {
+    return GetDefinition().type;
+}
+
+int Card::GetManaCost() const {
+    uint32_t dense = store.DenseIndex(handle);
+    if (dense == EntityStore::InvalidIndex) return 0;
 
-    if (type == CardType::CREATURE) {
-        SDL_SetRenderDrawColor(renderer, 50, 100, 200, 255);
-    } else {
-        SDL_SetRenderDrawColor(renderer, 150, 50, 200, 255);
-    }
+    return database.GetManaCost(store.card[dense]);
+}
 
-    SDL_RenderFillRect(renderer, &rect);
+bool Card::IsHovered() const {
+    uint32_t dense = store.DenseIndex(handle);
+    if (dense == EntityStore::InvalidIndex) return false;
 
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-    SDL_RenderDrawRect(renderer, &rect);
-}
\ No newline at end of file
+    return store.hovered[dense] != 0;
+}
+
+void Card::SetPosition(int x, int y) {
+    uint32_t dense = store.DenseIndex(handle);
+    if (dense == EntityStore::InvalidIndex) return;
+
+    store.SetPosition(dense, x, y);
+}
+
+void Card::Initialize() {}
+
+void Card::Update(float dt) {}
+
+void Card::Render(RenderQueue& queue, float alpha) {
+    uint32_t dense = store.DenseIndex(handle);
+    if (dense == EntityStore::InvalidIndex) return;
+
+    RenderCard(store, database, dense, queue, alpha);
+}
@@ -1,22 +1,36 @@
 #pragma once
-#include "./base/DynamicObject.hpp"
-#include <string>
+#include "../core/GameObject.hpp"
+#include "../core/EntityStore.hpp"
+#include "CardType.hpp"
+#include <string_view>
 
-enum class CardType {
-    CREATURE,
-    SPELL
-};
-
-class Card : public DynamicObject {
+/*
+    Adaptador: os dados da carta vivem no EntityStore do GameWorld.
+    O GameWorld desenha todas as cartas em uma unica passagem (RenderCards);
+    esta classe da acesso orientado a objeto a uma entidade especifica.
+*/
+class Card : public GameObject {
     private:
-        std::string name;
-        CardType type;
-        int manaCost;
+        EntityStore& store;
+        const CardDatabase& database;
+        EntityHandle handle;
     public:
-        Card(std::string name, CardType type, int manaCost, int x, int y);
+        Card(EntityStore& store, const CardDatabase& database, EntityHandle handle);
         virtual ~Card();
 
+        EntityHandle GetHandle() const { return handle; }
+        bool IsValid() const { return store.IsAlive(handle); }
+
+        // Com o handle morto: InvalidCard, definicao vazia, custo 0, sem hover
+        CardId GetId() const;
+        const CardDefinition& GetDefinition() const;
+        std::string_view GetName() const;
+        CardType GetType() const;
+        int GetManaCost() const;
+        bool IsHovered() const;
+        void SetPosition(int x, int y);
+
         virtual void Initialize() override;
         virtual void Update(float dt) override;
-        virtual void Render(SDL_Renderer* renderer) override;
-};
\ No newline at end of file
+        virtual void Render(RenderQueue& queue, float alpha) override;
+};
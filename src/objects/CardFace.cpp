@@ -0,0 +1,86 @@
+#include "CardFace.hpp"
+#include <algorithm>
+
+static constexpr int ManaPipSize = 8;
+static constexpr int ManaPipGap = 3;
+static constexpr int MaxManaPips = 10;
+
+SDL_Color CardFillColor(CardType type) {
+    if (type == CardType::CREATURE) {
+        return { 50, 100, 200, 255 };
+    }
+    return { 150, 50, 200, 255 };
+}
+
+const char* CardTypeName(CardType type) {
+    if (type == CardType::CREATURE) {
+        return "Criatura";
+    }
+    return "Feitiço";
+}
+
+SDL_Color CardBorderColor(bool hovered) {
+    if (hovered) {
+        return { 255, 220, 0, 255 };
+    }
+    return { 255, 255, 255, 255 };
+}
+
+// Faixa inferior do tipo e os marcadores de custo de mana
+template <typename Tfill>
+static void ForEachFaceDetail(const SDL_Rect& rect, const CardVisual& visual, Tfill fill) {
+    SDL_Color fillColor = CardFillColor(visual.type);
+    SDL_Color band = { (Uint8)(fillColor.r / 2), (Uint8)(fillColor.g / 2), (Uint8)(fillColor.b / 2), 255 };
+    fill(SDL_Rect { rect.x + 4, rect.y + rect.h - 28, rect.w - 8, 24 }, band);
+
+    int pips = std::clamp(visual.manaCost, 0, MaxManaPips);
+    for (int i = 0; i < pips; i++) {
+        fill(SDL_Rect { rect.x + 6 + i * (ManaPipSize + ManaPipGap), rect.y + 6, ManaPipSize, ManaPipSize },
+             SDL_Color { 80, 200, 255, 255 });
+    }
+}
+
+// Nome no topo (com quebra de linha) e tipo centralizado na faixa inferior
+template <typename Tdraw>
+static void ForEachFaceText(const SDL_Rect& rect, const CardVisual& visual, FontCache* font, Tdraw draw) {
+    if (!font) return;
+
+    TextLayout& name = font->GetLayout(visual.name, rect.w - 12);
+    draw(name, rect.x + 6, rect.y + 6 + ManaPipSize + 6);
+
+    TextLayout& type = font->GetLayout(CardTypeName(visual.type));
+    draw(type, rect.x + (rect.w - type.GetWidth()) / 2, rect.y + rect.h - 28 + (24 - type.GetHeight()) / 2);
+}
+
+void DrawCardFace(SDL_Renderer* renderer, const SDL_Rect& rect, const CardVisual& visual, FontCache* font) {
+    SDL_Color fill = CardFillColor(visual.type);
+    SDL_SetRenderDrawColor(renderer, fill.r, fill.g, fill.b, fill.a);
+    SDL_RenderFillRect(renderer, &rect);
+
+    ForEachFaceDetail(rect, visual, [renderer](const SDL_Rect& r, SDL_Color c) {
+        SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, c.a);
+        SDL_RenderFillRect(renderer, &r);
+    });
+
+    ForEachFaceText(rect, visual, font, [renderer](TextLayout& text, int x, int y) {
+        text.DrawImmediate(renderer, x, y, { 255, 255, 255, 255 });
+    });
+
+    SDL_Color border = CardBorderColor(visual.hovered);
+    SDL_SetRenderDrawColor(renderer, border.r, border.g, border.b, border.a);
+    SDL_RenderDrawRect(renderer, &rect);
+}
+
+void QueueCardFace(RenderQueue& queue, const SDL_Rect& rect, const CardVisual& visual, FontCache* font, int16_t layer) {
+    queue.FillRect(rect, CardFillColor(visual.type), layer);
+
+    ForEachFaceDetail(rect, visual, [&queue, layer](const SDL_Rect& r, SDL_Color c) {
+        queue.FillRect(r, c, layer);
+    });
+
+    ForEachFaceText(rect, visual, font, [&queue, layer](TextLayout& text, int x, int y) {
+        text.Draw(queue, x, y, { 255, 255, 255, 255 }, layer);
+    });
+
+    queue.DrawRect(rect, CardBorderColor(visual.hovered), layer);
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <string_view>
+#include <SDL2/SDL.h>
+#include "CardType.hpp"
+#include "../core/RenderQueue.hpp"
+#include "../core/TextRenderer.hpp"
+
+// Tudo o que define a aparencia de uma carta
+struct CardVisual {
+    std::string_view name;
+    CardType type;
+    int manaCost;
+    bool hovered;
+};
+
+SDL_Color CardFillColor(CardType type);
+SDL_Color CardBorderColor(bool hovered);
+
+const char* CardTypeName(CardType type);
+
+// Desenha a face direto no renderer (usado para rasterizar no cache de texturas).
+// font == nullptr: sem textos
+void DrawCardFace(SDL_Renderer* renderer, const SDL_Rect& rect, const CardVisual& visual, FontCache* font = nullptr);
+// Mesmo desenho via fila, quando nao ha cache disponivel
+void QueueCardFace(RenderQueue& queue, const SDL_Rect& rect, const CardVisual& visual, FontCache* font = nullptr,
+                   int16_t layer = LAYER_CARDS);
@@ -0,0 +1,49 @@
+#include "MapNode.hpp"
+
+static constexpr int LinkDots = 4;
+static constexpr int LinkDotSize = 3;
+
+static SDL_Color RoomColor(RoomType type) {
+    switch (type) {
+        case RoomType::ELITE:    return { 130, 40, 40, 255 };
+        case RoomType::REST:     return { 40, 110, 60, 255 };
+        case RoomType::TREASURE: return { 150, 120, 40, 255 };
+        case RoomType::BOSS:     return { 100, 30, 120, 255 };
+        case RoomType::BATTLE:   break;
+    }
+    return { 40, 50, 90, 255 };
+}
+
+MapNode::MapNode(int room, RoomType type, int x, int y, int size)
+    : StaticObject(x, y, size, size), room(room), type(type),
+      visited(false), current(false), selectable(false), selected(false) {
+}
+
+void MapNode::Initialize() {}
+
+void MapNode::Update(float dt) {}
+
+void MapNode::Render(RenderQueue& queue, float alpha) {
+    // Ligacoes pontilhadas; a linha sai do centro e os pontos das pontas ficam sob as salas
+    SDL_Point center = GetCenter();
+    for (const SDL_Point& target : links) {
+        for (int i = 1; i < LinkDots; i++) {
+            int dotX = center.x + (target.x - center.x) * i / LinkDots;
+            int dotY = center.y + (target.y - center.y) * i / LinkDots;
+            queue.FillRect({ dotX - LinkDotSize / 2, dotY - LinkDotSize / 2, LinkDotSize, LinkDotSize },
+                           { 120, 120, 140, 255 }, LAYER_BACKGROUND);
+        }
+    }
+
+    SDL_Rect rect = { x, y, width, height };
+    SDL_Color fill = visited ? SDL_Color{ 90, 90, 90, 255 } : RoomColor(type);
+    queue.FillRect(rect, fill, LAYER_BOARD);
+
+    if (selected) {
+        queue.DrawRect(rect, { 220, 180, 60, 255 }, LAYER_BOARD, 3);
+    } else if (current) {
+        queue.DrawRect(rect, { 255, 255, 255, 255 }, LAYER_BOARD, 3);
+    } else {
+        queue.DrawRect(rect, { 255, 255, 255, 255 }, LAYER_BOARD, selectable ? 2 : 1);
+    }
+}
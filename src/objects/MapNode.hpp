@@ -0,0 +1,35 @@
+#pragma once
+#include <vector>
+#include "base/StaticObject.hpp"
+#include "../logic/Tower.hpp"
+
+// Uma sala da torre no mapa, com as ligacoes para as salas do andar de cima
+class MapNode : public StaticObject {
+    private:
+        int room;
+        RoomType type;
+        std::vector<SDL_Point> links;   // centros das salas filhas
+        bool visited;
+        bool current;
+        bool selectable;
+        bool selected;
+    public:
+        MapNode(int room, RoomType type, int x, int y, int size);
+        virtual ~MapNode() {}
+
+        int GetRoom() const { return room; }
+        SDL_Point GetCenter() const { return { x + width / 2, y + height / 2 }; }
+        void AddLink(SDL_Point target) { links.push_back(target); }
+
+        void SetVisited(bool visited) { this->visited = visited; }
+        void SetCurrent(bool current) { this->current = current; }
+        // Uma das salas para onde o jogador pode ir; 'selected' e a que o ENTER escolhe
+        void SetSelectable(bool selectable, bool selected) {
+            this->selectable = selectable;
+            this->selected = selected;
+        }
+
+        virtual void Initialize() override;
+        virtual void Update(float dt) override;
+        virtual void Render(RenderQueue& queue, float alpha) override;
+};
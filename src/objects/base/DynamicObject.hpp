@@ -4,13 +4,28 @@
 class DynamicObject : public GameObject {
     protected:
         int x, y;
+        int prevX, prevY;
         int width, height;
         bool isHovered;
     public:
-        DynamicObject(int x, int y, int w, int h) : x(x), y(y), width(w), height(h), isHovered(false) {}
+        DynamicObject(int x, int y, int w, int h) : x(x), y(y), prevX(x), prevY(y), width(w), height(h), isHovered(false) {}
         virtual ~DynamicObject() {}
 
         virtual void Initialize() = 0;
+        virtual void StorePreviousState() override { prevX = x; prevY = y; }
         virtual void Update(float dt) = 0;
-        virtual void Render(SDL_Renderer* renderer) = 0;
-};
\ No newline at end of file
+        virtual bool NeedsRedraw() const override { return x != prevX || y != prevY; }
+        virtual void Render(RenderQueue& queue, float alpha) = 0;
+
+        virtual bool GetBounds(SDL_Rect& out) const override { out = { x, y, width, height }; return true; }
+        virtual void SetHovered(bool hovered) override { isHovered = hovered; }
+
+        SDL_Rect GetInterpolatedRect(float alpha) const {
+            return {
+                prevX + (int)((x - prevX) * alpha),
+                prevY + (int)((y - prevY) * alpha),
+                width,
+                height
+            };
+        }
+};
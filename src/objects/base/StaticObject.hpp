@@ -10,5 +10,7 @@ class StaticObject : public GameObject {
         virtual ~StaticObject() {}
 
         virtual void Initialize() = 0;
-        virtual void Render(SDL_Renderer* renderer) = 0;
-};
\ No newline at end of file
+        virtual void Render(RenderQueue& queue, float alpha) = 0;
+
+        virtual bool GetBounds(SDL_Rect& out) const override { out = { x, y, width, height }; return true; }
+};
@@ -0,0 +1,59 @@
+#include "Button.hpp"
+#include <algorithm>
+
+static constexpr int MinButtonWidth = 96;
+static constexpr int MinButtonHeight = 32;
+
+Button::Button(const std::string& label, std::function<void()> onClick, const NodeStyle& style)
+    : Node(style), label(label), onClick(std::move(onClick)) {
+    enabled = true;
+    if (this->style.padding == 0) this->style.padding = 8;
+}
+
+void Button::SetLabel(const std::string& label) {
+    if (this->label == label) return;
+
+    this->label = label;
+    OnFontChanged();
+    MarkMeasureDirty();
+    MarkDrawDirty();
+}
+
+void Button::SetEnabled(bool enabled) {
+    if (this->enabled == enabled) return;
+
+    this->enabled = enabled;
+    if (!enabled) SetHovered(false);
+    MarkDrawDirty();
+}
+
+void Button::OnFontChanged() {
+    text.Set(font, label);
+}
+
+void Button::MeasureContent(int& width, int& height) {
+    width = std::max(text.GetWidth(), MinButtonWidth - 2 * style.padding);
+    height = std::max(text.GetHeight(), MinButtonHeight - 2 * style.padding);
+}
+
+void Button::BuildDrawList(UiDrawList& list) {
+    SDL_Color fill = { 60, 60, 70, 255 };
+    if (!enabled) {
+        fill = { 35, 35, 40, 255 };
+    } else if (hovered) {
+        fill = { 90, 90, 110, 255 };
+    }
+
+    list.FillRect(rect, fill);
+    list.DrawRect(rect, enabled ? SDL_Color{ 220, 220, 220, 255 } : SDL_Color{ 100, 100, 100, 255 });
+
+    if (font) {
+        int x = rect.x + (rect.w - text.GetWidth()) / 2;
+        int y = rect.y + (rect.h - text.GetHeight()) / 2;
+        list.DrawText(text, x, y, enabled ? SDL_Color{ 255, 255, 255, 255 } : SDL_Color{ 140, 140, 140, 255 });
+    }
+}
+
+void Button::OnClick() {
+    if (enabled && onClick) onClick();
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <string>
+#include <functional>
+#include "Node.hpp"
+
+class Button : public Node {
+    private:
+        std::string label;
+        TextLayout text;
+        std::function<void()> onClick;
+        bool enabled;
+    protected:
+        virtual void MeasureContent(int& width, int& height) override;
+        virtual void BuildDrawList(UiDrawList& list) override;
+        virtual void OnFontChanged() override;
+    public:
+        Button(const std::string& label, std::function<void()> onClick = nullptr, const NodeStyle& style = NodeStyle());
+
+        void SetLabel(const std::string& label);
+        void SetOnClick(std::function<void()> onClick) { this->onClick = std::move(onClick); }
+        void SetEnabled(bool enabled);
+
+        virtual bool IsInteractive() const override { return enabled; }
+        virtual void OnClick() override;
+};
@@ -0,0 +1,44 @@
+#include "HealthBar.hpp"
+#include <algorithm>
+#include <string>
+
+HealthBar::HealthBar(int current, int maximum, const NodeStyle& style)
+    : Node(style), current(current), maximum(maximum) {
+    if (this->style.width < 0) this->style.width = 200;
+    if (this->style.height < 0) this->style.height = 22;
+}
+
+void HealthBar::UpdateText() {
+    text.Set(font, std::to_string(current) + "/" + std::to_string(maximum));
+}
+
+void HealthBar::SetValue(int current, int maximum) {
+    if (this->current == current && this->maximum == maximum) return;
+
+    this->current = current;
+    this->maximum = maximum;
+    UpdateText();
+    MarkDrawDirty();
+}
+
+void HealthBar::MeasureContent(int& width, int& height) {
+    width = text.GetWidth();
+    height = text.GetHeight();
+}
+
+void HealthBar::BuildDrawList(UiDrawList& list) {
+    list.FillRect(rect, { 50, 20, 20, 255 });
+
+    if (maximum > 0) {
+        int filled = rect.w * std::clamp(current, 0, maximum) / maximum;
+        list.FillRect({ rect.x, rect.y, filled, rect.h }, { 190, 40, 40, 255 });
+    }
+
+    list.DrawRect(rect, { 255, 255, 255, 255 });
+
+    if (font) {
+        int x = rect.x + (rect.w - text.GetWidth()) / 2;
+        int y = rect.y + (rect.h - text.GetHeight()) / 2;
+        list.DrawText(text, x, y, { 255, 255, 255, 255 });
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "Node.hpp"
+
+class HealthBar : public Node {
+    private:
+        int current;
+        int maximum;
+        TextLayout text;
+
+        void UpdateText();
+    protected:
+        virtual void MeasureContent(int& width, int& height) override;
+        virtual void BuildDrawList(UiDrawList& list) override;
+        virtual void OnFontChanged() override { UpdateText(); }
+    public:
+        HealthBar(int current, int maximum, const NodeStyle& style = NodeStyle());
+
+        // Mudar o valor so refaz a lista de desenho; o tamanho continua o mesmo
+        void SetValue(int current, int maximum);
+        int GetCurrent() const { return current; }
+        int GetMaximum() const { return maximum; }
+};
@@ -0,0 +1,36 @@
+#include "ManaDisplay.hpp"
+#include <algorithm>
+
+ManaDisplay::ManaDisplay(int current, int maximum, const NodeStyle& style)
+    : Node(style), current(current), maximum(maximum) {
+}
+
+void ManaDisplay::SetValue(int current, int maximum) {
+    if (this->current == current && this->maximum == maximum) return;
+
+    // So o maximo muda o numero de gemas, e portanto o tamanho
+    if (this->maximum != maximum) {
+        MarkMeasureDirty();
+    }
+
+    this->current = current;
+    this->maximum = maximum;
+    MarkDrawDirty();
+}
+
+void ManaDisplay::MeasureContent(int& width, int& height) {
+    width = maximum > 0 ? maximum * GemSize + (maximum - 1) * GemGap : 0;
+    height = GemSize;
+}
+
+void ManaDisplay::BuildDrawList(UiDrawList& list) {
+    const int filled = std::clamp(current, 0, maximum);
+    const int x = rect.x + style.padding;
+    const int y = rect.y + (rect.h - GemSize) / 2;
+
+    for (int i = 0; i < maximum; i++) {
+        SDL_Rect gem = { x + i * (GemSize + GemGap), y, GemSize, GemSize };
+        list.FillRect(gem, i < filled ? SDL_Color{ 60, 140, 255, 255 } : SDL_Color{ 30, 40, 70, 255 });
+        list.DrawRect(gem, { 200, 220, 255, 255 });
+    }
+}
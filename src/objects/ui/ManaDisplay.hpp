@@ -0,0 +1,21 @@
+#pragma once
+#include "Node.hpp"
+
+// Uma gema por ponto de mana maximo; as cheias sao a mana disponivel
+class ManaDisplay : public Node {
+    private:
+        int current;
+        int maximum;
+    protected:
+        virtual void MeasureContent(int& width, int& height) override;
+        virtual void BuildDrawList(UiDrawList& list) override;
+    public:
+        static constexpr int GemSize = 18;
+        static constexpr int GemGap = 4;
+
+        ManaDisplay(int current, int maximum, const NodeStyle& style = NodeStyle());
+
+        void SetValue(int current, int maximum);
+        int GetCurrent() const { return current; }
+        int GetMaximum() const { return maximum; }
+};
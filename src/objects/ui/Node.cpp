@@ -0,0 +1,364 @@
+#include "Node.hpp"
+#include <algorithm>
+
+void UiDrawList::FillRect(const SDL_Rect& rect, SDL_Color color) {
+    commands.push_back({ Type::FILL, rect, color, 0, nullptr });
+}
+
+void UiDrawList::DrawRect(const SDL_Rect& rect, SDL_Color color, int thickness) {
+    commands.push_back({ Type::OUTLINE, rect, color, thickness, nullptr });
+}
+
+void UiDrawList::DrawText(TextLayout& text, int x, int y, SDL_Color color) {
+    commands.push_back({ Type::TEXT, { x, y, 0, 0 }, color, 0, &text });
+}
+
+void UiDrawList::Replay(RenderQueue& queue, int16_t layer) const {
+    for (const Command& cmd : commands) {
+        switch (cmd.type) {
+            case Type::FILL:
+                queue.FillRect(cmd.rect, cmd.color, layer);
+                break;
+            case Type::OUTLINE:
+                queue.DrawRect(cmd.rect, cmd.color, layer, cmd.thickness);
+                break;
+            case Type::TEXT:
+                cmd.text->Draw(queue, cmd.rect.x, cmd.rect.y, cmd.color, layer);
+                break;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+Node::Node(const NodeStyle& style)
+    : style(style) {
+    parent = nullptr;
+    measureDirty = true;
+    layoutDirty = true;
+    drawDirty = true;
+    subtreeChanged = true;
+    rect = { 0, 0, 0, 0 };
+    drawnRect = { 0, 0, 0, 0 };
+    measuredWidth = 0;
+    measuredHeight = 0;
+    visible = true;
+    hovered = false;
+    font = nullptr;
+}
+
+void Node::PropagateChanged() {
+    for (Node* node = this; node && !node->subtreeChanged; node = node->parent) {
+        node->subtreeChanged = true;
+    }
+}
+
+void Node::MarkMeasureDirty() {
+    // Um tamanho diferente pode mover os irmaos: todos os ancestrais refazem o layout
+    for (Node* node = this; node && !node->measureDirty; node = node->parent) {
+        node->measureDirty = true;
+        node->layoutDirty = true;
+    }
+    PropagateChanged();
+}
+
+void Node::MarkDrawDirty() {
+    drawDirty = true;
+    PropagateChanged();
+}
+
+void Node::Remove(Node* child) {
+    auto it = std::find_if(children.begin(), children.end(),
+        [child](const std::unique_ptr<Node>& node) { return node.get() == child; });
+    if (it == children.end()) return;
+
+    children.erase(it);
+    // O filho sumiu da tela junto com a sua lista; a area do pai cobre onde ele estava
+    drawnRect = rect;
+    MarkMeasureDirty();
+    MarkDrawDirty();
+}
+
+void Node::SetStyle(const NodeStyle& style) {
+    this->style = style;
+    MarkMeasureDirty();
+}
+
+void Node::SetVisible(bool visible) {
+    if (this->visible == visible) return;
+
+    this->visible = visible;
+    MarkMeasureDirty();
+    MarkDrawDirty();
+}
+
+void Node::SetFont(FontCache* font) {
+    if (this->font != font) {
+        this->font = font;
+        OnFontChanged();
+        MarkMeasureDirty();
+        MarkDrawDirty();
+    }
+
+    for (auto& child : children) {
+        child->SetFont(font);
+    }
+}
+
+void Node::SetHovered(bool hovered) {
+    if (this->hovered == hovered) return;
+
+    this->hovered = hovered;
+    MarkDrawDirty();
+}
+
+void Node::Measure() {
+    if (!measureDirty) return;
+
+    int contentWidth, contentHeight;
+    MeasureContent(contentWidth, contentHeight);
+
+    const bool row = style.direction == LayoutDirection::ROW;
+    int mainSum = 0;
+    int crossMax = 0;
+    int count = 0;
+
+    for (auto& child : children) {
+        if (!child->visible) continue;
+
+        child->Measure();
+        mainSum += row ? child->measuredWidth : child->measuredHeight;
+        crossMax = std::max(crossMax, row ? child->measuredHeight : child->measuredWidth);
+        count++;
+    }
+    if (count > 1) mainSum += style.gap * (count - 1);
+
+    int width = std::max(contentWidth, row ? mainSum : crossMax);
+    int height = std::max(contentHeight, row ? crossMax : mainSum);
+
+    measuredWidth = style.width >= 0 ? style.width : width + 2 * style.padding;
+    measuredHeight = style.height >= 0 ? style.height : height + 2 * style.padding;
+
+    measureDirty = false;
+    layoutDirty = true;
+}
+
+void Node::Arrange(const SDL_Rect& target) {
+    const bool moved = target.x != rect.x || target.y != rect.y || target.w != rect.w || target.h != rect.h;
+
+    // Mesmo lugar e nada sujo por baixo: a subarvore inteira continua valida
+    if (!moved && !layoutDirty) return;
+
+    if (moved) {
+        rect = target;
+        MarkDrawDirty();
+    }
+    layoutDirty = false;
+
+    const bool row = style.direction == LayoutDirection::ROW;
+    const int innerX = rect.x + style.padding;
+    const int innerY = rect.y + style.padding;
+    const int innerMain = (row ? rect.w : rect.h) - 2 * style.padding;
+    const int innerCross = (row ? rect.h : rect.w) - 2 * style.padding;
+
+    int used = 0;
+    int count = 0;
+    float totalGrow = 0.0f;
+    for (auto& child : children) {
+        if (!child->visible) continue;
+
+        used += row ? child->measuredWidth : child->measuredHeight;
+        totalGrow += child->style.grow;
+        count++;
+    }
+    if (count > 1) used += style.gap * (count - 1);
+
+    const int freeSpace = std::max(0, innerMain - used);
+
+    int position = 0;
+    if (totalGrow <= 0.0f) {
+        if (style.justify == LayoutAlign::CENTER) position = freeSpace / 2;
+        else if (style.justify == LayoutAlign::END) position = freeSpace;
+    }
+
+    for (auto& child : children) {
+        if (!child->visible) continue;
+
+        int main = row ? child->measuredWidth : child->measuredHeight;
+        if (totalGrow > 0.0f && child->style.grow > 0.0f) {
+            main += (int)(freeSpace * (child->style.grow / totalGrow));
+        }
+
+        int cross = row ? child->measuredHeight : child->measuredWidth;
+        int crossOffset = 0;
+        switch (style.align) {
+            case LayoutAlign::CENTER: crossOffset = (innerCross - cross) / 2; break;
+            case LayoutAlign::END: crossOffset = innerCross - cross; break;
+            case LayoutAlign::STRETCH: cross = innerCross; break;
+            default: break;
+        }
+
+        SDL_Rect childRect;
+        if (row) {
+            childRect = { innerX + position, innerY + crossOffset, main, cross };
+        } else {
+            childRect = { innerX + crossOffset, innerY + position, cross, main };
+        }
+        child->Arrange(childRect);
+
+        position += main + style.gap;
+    }
+}
+
+void Node::RebuildDrawList() {
+    drawList.Clear();
+    BuildDrawList(drawList);
+    drawnRect = drawList.Size() > 0 ? rect : SDL_Rect { 0, 0, 0, 0 };
+    drawDirty = false;
+}
+
+void Node::DamageHidden(DamageTracker& damage) {
+    // Apaga o que estava desenhado e obriga a subarvore a se redesenhar quando voltar
+    damage.Add(drawnRect);
+    drawnRect = { 0, 0, 0, 0 };
+    drawDirty = true;
+    subtreeChanged = true;
+
+    for (auto& child : children) {
+        child->DamageHidden(damage);
+    }
+}
+
+void Node::CollectDamage(DamageTracker& damage) {
+    if (!subtreeChanged) return;
+
+    if (!visible) {
+        DamageHidden(damage);
+        return;
+    }
+
+    if (drawDirty) {
+        damage.Add(drawnRect);
+        RebuildDrawList();
+        damage.Add(drawnRect);
+    }
+
+    for (auto& child : children) {
+        child->CollectDamage(damage);
+    }
+}
+
+void Node::Render(RenderQueue& queue, int16_t layer) {
+    if (!visible) {
+        subtreeChanged = false;
+        return;
+    }
+
+    if (drawDirty) {
+        RebuildDrawList();
+    }
+    drawList.Replay(queue, layer);
+
+    for (auto& child : children) {
+        child->Render(queue, layer);
+    }
+    subtreeChanged = false;
+}
+
+Node* Node::Pick(int x, int y) {
+    if (!visible) return nullptr;
+    if (x < rect.x || x >= rect.x + rect.w || y < rect.y || y >= rect.y + rect.h) return nullptr;
+
+    // Filhos desenhados por ultimo ficam por cima
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+        if (Node* hit = (*it)->Pick(x, y)) return hit;
+    }
+    return IsInteractive() ? this : nullptr;
+}
+
+// ---------------------------------------------------------------------------
+
+UiRoot::UiRoot(int width, int height)
+    : width(width), height(height) {
+    input = nullptr;
+    hoveredNode = nullptr;
+    pressedNode = nullptr;
+}
+
+UiRoot::~UiRoot() {
+    UnbindInput();
+}
+
+void UiRoot::SetSize(int width, int height) {
+    this->width = width;
+    this->height = height;
+}
+
+void UiRoot::BindInput(InputManager& input) {
+    UnbindInput();
+
+    this->input = &input;
+    mouseMotionDescriptor = input.mouseMotion.subscribe(
+        Mylib::Event::make_callback_object<MouseMotionEvent>(*this, &UiRoot::OnMouseMotion));
+    mouseButtonDescriptor = input.mouseButton.subscribe(
+        Mylib::Event::make_callback_object<MouseButtonEvent>(*this, &UiRoot::OnMouseButton));
+}
+
+void UiRoot::UnbindInput() {
+    if (input && mouseMotionDescriptor.is_valid()) {
+        input->mouseMotion.unsubscribe(mouseMotionDescriptor);
+    }
+    if (input && mouseButtonDescriptor.is_valid()) {
+        input->mouseButton.unsubscribe(mouseButtonDescriptor);
+    }
+    input = nullptr;
+    ResetPointer();
+}
+
+void UiRoot::ResetPointer() {
+    if (hoveredNode) hoveredNode->SetHovered(false);
+    hoveredNode = nullptr;
+    pressedNode = nullptr;
+}
+
+void UiRoot::OnMouseMotion(MouseMotionEvent& event) {
+    Node* hit = root.Pick(event.x, event.y);
+    if (hit == hoveredNode) return;
+
+    if (hoveredNode) hoveredNode->SetHovered(false);
+    if (hit) hit->SetHovered(true);
+    hoveredNode = hit;
+}
+
+void UiRoot::OnMouseButton(MouseButtonEvent& event) {
+    if (event.button != SDL_BUTTON_LEFT) return;
+
+    Node* hit = root.Pick(event.x, event.y);
+
+    if (event.pressed) {
+        pressedNode = hit;
+        if (hit) hit->OnPress();
+        return;
+    }
+
+    // Clique: soltou sobre o mesmo no em que apertou
+    if (hit && hit == pressedNode) {
+        hit->OnClick();
+    }
+    pressedNode = nullptr;
+}
+
+void UiRoot::Layout() {
+    root.Measure();
+    root.Arrange({ 0, 0, width, height });
+}
+
+void UiRoot::CollectDamage(DamageTracker& damage) {
+    Layout();
+    root.CollectDamage(damage);
+}
+
+void UiRoot::Render(RenderQueue& queue, int16_t layer) {
+    Layout();
+    root.Render(queue, layer);
+}
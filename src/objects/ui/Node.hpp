@@ -0,0 +1,177 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <utility>
+#include <SDL2/SDL.h>
+#include "../../core/RenderQueue.hpp"
+#include "../../core/TextRenderer.hpp"
+#include "../../core/InputManager.hpp"
+#include "../../core/DamageTracker.hpp"
+
+enum class LayoutDirection : uint8_t {
+    ROW,
+    COLUMN
+};
+
+enum class LayoutAlign : uint8_t {
+    START,
+    CENTER,
+    END,
+    STRETCH     // so no eixo cruzado
+};
+
+// Flexbox simplificado: filhos em linha ou coluna, com espaco livre dividido por 'grow'
+struct NodeStyle {
+    int width = -1;             // -1: medido pelo conteudo
+    int height = -1;
+    int padding = 0;
+    int gap = 0;
+    float grow = 0.0f;
+    LayoutDirection direction = LayoutDirection::COLUMN;
+    LayoutAlign align = LayoutAlign::START;     // eixo cruzado
+    LayoutAlign justify = LayoutAlign::START;   // eixo principal, quando nenhum filho cresce
+};
+
+// Primitivas de um no, guardadas entre quadros e reenviadas a RenderQueue
+class UiDrawList {
+    private:
+        enum class Type : uint8_t {
+            FILL,
+            OUTLINE,
+            TEXT
+        };
+
+        struct Command {
+            Type type;
+            SDL_Rect rect;
+            SDL_Color color;
+            int thickness;
+            TextLayout* text;   // pertence ao no dono da lista
+        };
+
+        std::vector<Command> commands;
+    public:
+        void Clear() { commands.clear(); }
+        void FillRect(const SDL_Rect& rect, SDL_Color color);
+        void DrawRect(const SDL_Rect& rect, SDL_Color color, int thickness = 1);
+        void DrawText(TextLayout& text, int x, int y, SDL_Color color);
+        void Replay(RenderQueue& queue, int16_t layer) const;
+        size_t Size() const { return commands.size(); }
+};
+
+/*
+    No da arvore de UI retida. Tres marcas de sujeira:
+        measureDirty  o tamanho pedido pode ter mudado; sobe ate a raiz
+        layoutDirty   os filhos precisam ser reposicionados
+        drawDirty     a lista de desenho do proprio no precisa ser refeita
+    Arrange() pula subarvores cujo retangulo nao mudou e que nao estao sujas,
+    e Render() so refaz as listas sujas; o resto apenas e reenviado.
+*/
+class Node {
+    private:
+        Node* parent;
+        std::vector<std::unique_ptr<Node>> children;
+
+        bool measureDirty;
+        bool layoutDirty;
+        bool drawDirty;
+        bool subtreeChanged;    // algo abaixo (ou aqui) mudou desde o ultimo Render
+
+        UiDrawList drawList;
+        SDL_Rect drawnRect;     // onde a lista atual foi desenhada; vazio se nada foi
+
+        void PropagateChanged();
+        void RebuildDrawList();
+        void DamageHidden(DamageTracker& damage);
+    protected:
+        NodeStyle style;
+        SDL_Rect rect;
+        int measuredWidth, measuredHeight;
+        bool visible;
+        bool hovered;
+        FontCache* font;
+
+        // Tamanho do conteudo proprio, sem padding nem filhos
+        virtual void MeasureContent(int& width, int& height) { width = 0; height = 0; }
+        // Desenha o conteudo proprio em 'rect'
+        virtual void BuildDrawList(UiDrawList& list) {}
+        virtual void OnFontChanged() {}
+
+        void MarkMeasureDirty();
+        void MarkDrawDirty();
+    public:
+        Node(const NodeStyle& style = NodeStyle());
+        virtual ~Node() {}
+
+        Node(const Node&) = delete;
+        Node& operator=(const Node&) = delete;
+
+        template <typename T, typename... Args>
+        T* Add(Args&&... args) {
+            auto child = std::make_unique<T>(std::forward<Args>(args)...);
+            T* raw = child.get();
+            raw->parent = this;
+            raw->SetFont(font);
+            children.push_back(std::move(child));
+            MarkMeasureDirty();
+            return raw;
+        }
+        void Remove(Node* child);
+
+        void SetStyle(const NodeStyle& style);
+        const NodeStyle& GetStyle() const { return style; }
+        void SetVisible(bool visible);
+        bool IsVisible() const { return visible; }
+        void SetFont(FontCache* font);
+        const SDL_Rect& GetRect() const { return rect; }
+        int GetMeasuredWidth() const { return measuredWidth; }
+        int GetMeasuredHeight() const { return measuredHeight; }
+
+        // Botoes e afins; nos nao interativos sao transparentes ao mouse
+        virtual bool IsInteractive() const { return false; }
+        void SetHovered(bool hovered);
+        virtual void OnPress() {}
+        virtual void OnClick() {}
+
+        void Measure();
+        void Arrange(const SDL_Rect& rect);
+        void Render(RenderQueue& queue, int16_t layer);
+        bool HasChanges() const { return subtreeChanged || measureDirty || layoutDirty; }
+        // Area antiga e nova dos nos redesenhados; refaz as listas sujas (o Render so reenvia)
+        void CollectDamage(DamageTracker& damage);
+        // No interativo mais profundo sob o ponto
+        Node* Pick(int x, int y);
+};
+
+// Raiz de uma arvore de UI: ocupa a tela, faz o layout e roteia o mouse
+class UiRoot {
+    private:
+        Node root;
+        int width, height;
+
+        InputManager* input;
+        Mylib::Event::Handler<MouseMotionEvent>::Descriptor mouseMotionDescriptor;
+        Mylib::Event::Handler<MouseButtonEvent>::Descriptor mouseButtonDescriptor;
+
+        Node* hoveredNode;
+        Node* pressedNode;
+    public:
+        UiRoot(int width, int height);
+        ~UiRoot();
+
+        Node& GetRoot() { return root; }
+        void SetSize(int width, int height);
+        void SetFont(FontCache* font) { root.SetFont(font); }
+
+        void BindInput(InputManager& input);
+        void UnbindInput();
+        void OnMouseMotion(MouseMotionEvent& event);
+        void OnMouseButton(MouseButtonEvent& event);
+        // Esquece nos que vao ser removidos da arvore
+        void ResetPointer();
+
+        void Layout();
+        bool NeedsRedraw() const { return root.HasChanges(); }
+        void CollectDamage(DamageTracker& damage);
+        void Render(RenderQueue& queue, int16_t layer = LAYER_UI);
+};
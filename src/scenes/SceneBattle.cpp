@@ -0,0 +1,142 @@
+#include "SceneBattle.hpp"
+#include "../core/SceneManager.hpp"
+#include "../logic/RunState.hpp"
+#include "../objects/Card.hpp"
+#include <algorithm>
+
+static constexpr int HandSize = 5;
+
+SceneBattle::SceneBattle(SceneManager& scenes, const Random& random)
+    : Scene(scenes, scenes.GetCardDatabase()), deck(random) {
+    input = nullptr;
+    health = 30;
+    maxHealth = 30;
+    mana = 1;
+    maxMana = 1;
+    turn = 1;
+    finished = false;
+    healthBar = nullptr;
+    manaDisplay = nullptr;
+    endTurnButton = nullptr;
+}
+
+SceneBattle::~SceneBattle() {
+    Exit();
+}
+
+void SceneBattle::Build() {
+    health = scenes.GetRun()->GetHealth();
+    maxHealth = scenes.GetRun()->GetMaxHealth();
+    BuildDeck();
+    DrawHand();
+    BuildHud();
+}
+
+void SceneBattle::BuildDeck() {
+    // O baralho da subida; os modificadores das cartas ainda nao entram na batalha
+    const RunState& run = *scenes.GetRun();
+
+    deck.Clear();
+    for (int i = 0; i < run.GetDeckSize(); i++) {
+        deck.Add(run.GetCard(i).id);
+    }
+    deck.Shuffle();
+}
+
+void SceneBattle::DrawHand() {
+    for (int i = 0; i < HandSize; i++) {
+        CardId id = deck.Draw();
+        if (id == InvalidCard) break;
+
+        Card* card = world.SpawnCard(id, 100 + i * 150, 200);
+        if (card) hand.push_back(card);
+    }
+}
+
+void SceneBattle::DiscardHand() {
+    for (Card* card : hand) {
+        deck.Discard(card->GetId());
+        world.DestroyCard(card);
+    }
+    hand.clear();
+}
+
+void SceneBattle::BuildHud() {
+    NodeStyle rootStyle;
+    rootStyle.justify = LayoutAlign::END;
+    rootStyle.align = LayoutAlign::STRETCH;
+    ui.GetRoot().SetStyle(rootStyle);
+
+    // Barra inferior: vida e mana a esquerda, botao de fim de turno a direita
+    NodeStyle barStyle;
+    barStyle.direction = LayoutDirection::ROW;
+    barStyle.align = LayoutAlign::CENTER;
+    barStyle.padding = 12;
+    barStyle.gap = 16;
+    Node* bar = ui.GetRoot().Add<Node>(barStyle);
+
+    healthBar = bar->Add<HealthBar>(health, maxHealth);
+    manaDisplay = bar->Add<ManaDisplay>(mana, maxMana);
+
+    NodeStyle spacer;
+    spacer.grow = 1.0f;
+    bar->Add<Node>(spacer);
+
+    endTurnButton = bar->Add<Button>("Encerrar turno", [this] { EndTurn(); });
+}
+
+void SceneBattle::EndTurn() {
+    turn++;
+    maxMana = std::min(maxMana + 1, 10);
+    mana = maxMana;
+    manaDisplay->SetValue(mana, maxMana);
+
+    DiscardHand();
+    DrawHand();
+}
+
+void SceneBattle::Enter(InputManager& input) {
+    Scene::Enter(input);
+
+    this->input = &input;
+    keyDescriptor = input.key.subscribe(Mylib::Event::make_callback_object<KeyEvent>(*this, &SceneBattle::OnKey));
+}
+
+void SceneBattle::Exit() {
+    if (input && keyDescriptor.is_valid()) {
+        input->key.unsubscribe(keyDescriptor);
+    }
+    input = nullptr;
+
+    Scene::Exit();
+}
+
+void SceneBattle::OnKey(KeyEvent& event) {
+    if (!event.pressed || event.repeat) return;
+
+    if (event.key == SDLK_BACKSPACE) {
+        Finish();
+    }
+}
+
+void SceneBattle::Finish() {
+    // A troca so acontece no proximo quadro; um segundo pedido nao salva nem desempilha de novo
+    if (finished) return;
+    finished = true;
+
+    // O baralho da subida nao muda: a batalha so embaralha copias dos ids
+    RunState& run = *scenes.GetRun();
+    run.SetHealth(health);
+    /*
+        O baralho partiu do estado do gerador da subida; pular 2^128 passos agora
+        tem o mesmo efeito de um Split() na hora em que a sala foi escolhida. Dividir
+        ja na Preload nao serve: a batalha e montada antes de o jogador escolher, e
+        uma sala sem luta salva no meio, entao ao carregar a semente seria outra.
+    */
+    run.GetRandom().Jump();
+    // A sala so conta como resolvida aqui; sair no meio da luta volta para antes dela
+    scenes.SaveRun();
+
+    // Cada sala tem a sua batalha: mao, compra, turno e mana nao passam para a proxima
+    scenes.Pop(true);
+}
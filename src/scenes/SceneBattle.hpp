@@ -0,0 +1,46 @@
+#pragma once
+#include "../core/Scene.hpp"
+#include "../objects/ui/Button.hpp"
+#include "../objects/ui/HealthBar.hpp"
+#include "../objects/ui/ManaDisplay.hpp"
+#include "../logic/Deck.hpp"
+
+// Batalha de um andar; BACKSPACE volta ao mapa e descarta a cena
+class SceneBattle : public Scene {
+    private:
+        InputManager* input;
+        Mylib::Event::Handler<KeyEvent>::Descriptor keyDescriptor;
+
+        int health, maxHealth;
+        int mana, maxMana;
+        int turn;
+        bool finished;
+
+        // Compra e descarte; a mao sao as cartas no mundo
+        Deck deck;
+        std::vector<Card*> hand;
+
+        // HUD; os nos pertencem a arvore da UI
+        HealthBar* healthBar;
+        ManaDisplay* manaDisplay;
+        Button* endTurnButton;
+
+        void BuildDeck();
+        void BuildHud();
+        void DrawHand();
+        void DiscardHand();
+        // Leva o resultado para a subida, salva e volta ao mapa
+        void Finish();
+    public:
+        // Mesmo gerador, mesmas compras; o da subida e avancado quando a luta termina
+        SceneBattle(SceneManager& scenes, const Random& random);
+        virtual ~SceneBattle();
+
+        virtual void Build() override;
+        virtual void Enter(InputManager& input) override;
+        virtual void Exit() override;
+
+        void OnKey(KeyEvent& event);
+        void EndTurn();
+        int GetTurn() const { return turn; }
+};
@@ -0,0 +1,116 @@
+#include "SceneMap.hpp"
+#include "../core/SceneManager.hpp"
+
+static constexpr int NodeSize = 28;
+static constexpr int BossSize = 44;
+static constexpr int ColumnSpacing = 80;
+static constexpr int FloorSpacing = 42;
+static constexpr int BottomY = 652;
+
+SceneMap::SceneMap(SceneManager& scenes)
+    : Scene(scenes, scenes.GetCardDatabase()), tower(scenes.GetRun()->GetTower()) {
+    selected = 0;
+    inBattle = false;
+    input = nullptr;
+}
+
+SceneMap::~SceneMap() {
+    Exit();
+}
+
+void SceneMap::Build() {
+    const Tower& map = tower.GetTower();
+    const int left = 640 - (map.GetSettings().width - 1) * ColumnSpacing / 2;
+
+    for (int room = 0; room < map.GetRoomCount(); room++) {
+        const TowerRoom& info = map.GetRoom(room);
+        int size = info.type == RoomType::BOSS ? BossSize : NodeSize;
+        int centerX = left + info.column * ColumnSpacing;
+        int centerY = BottomY - info.floor * FloorSpacing;
+        nodes.push_back(world.Spawn<MapNode>(room, info.type, centerX - size / 2, centerY - size / 2, size));
+    }
+
+    // Os filhos vem depois na ordem das salas: so da para ligar com todos os nos criados
+    for (int room = 0; room < map.GetRoomCount(); room++) {
+        const uint8_t* children = map.GetChildren(room);
+        for (int i = 0; i < map.GetChildCount(room); i++) {
+            nodes[room]->AddLink(nodes[children[i]]->GetCenter());
+        }
+    }
+    RefreshNodes();
+}
+
+void SceneMap::RefreshNodes() {
+    int current = tower.GetCurrentRoom();
+    int choice = tower.GetChoice(selected);
+
+    for (MapNode* node : nodes) {
+        node->SetVisited(tower.WasVisited(node->GetRoom()) && node->GetRoom() != current);
+        node->SetCurrent(node->GetRoom() == current);
+        node->SetSelectable(false, false);
+    }
+    for (int i = 0; i < tower.GetChoiceCount(); i++) {
+        int room = tower.GetChoice(i);
+        nodes[room]->SetSelectable(true, room == choice);
+    }
+    world.MarkDirty();
+}
+
+void SceneMap::EnterSelected() {
+    int room = tower.GetChoice(selected);
+    if (room < 0 || !tower.Advance(selected)) return;
+
+    selected = 0;
+    RefreshNodes();
+
+    // Descanso e tesouro ainda nao tem tela propria: a sala so e marcada e ja esta resolvida.
+    // Uma luta so e salva quando termina (SceneBattle::Finish)
+    RoomType type = tower.GetTower().GetRoom(room).type;
+    if (type == RoomType::BATTLE || type == RoomType::ELITE || type == RoomType::BOSS) {
+        inBattle = true;
+        scenes.Push(SceneId::BATTLE);
+    } else {
+        scenes.SaveRun();
+    }
+}
+
+void SceneMap::Enter(InputManager& input) {
+    Scene::Enter(input);
+
+    if (inBattle) {
+        inBattle = false;
+        RefreshNodes();
+    }
+
+    this->input = &input;
+    keyDescriptor = input.key.subscribe(Mylib::Event::make_callback_object<KeyEvent>(*this, &SceneMap::OnKey));
+
+    // A batalha e montada enquanto o jogador olha o mapa
+    scenes.Preload(SceneId::BATTLE);
+}
+
+void SceneMap::Exit() {
+    if (input && keyDescriptor.is_valid()) {
+        input->key.unsubscribe(keyDescriptor);
+    }
+    input = nullptr;
+
+    Scene::Exit();
+}
+
+void SceneMap::OnKey(KeyEvent& event) {
+    if (!event.pressed || event.repeat || inBattle) return;
+
+    int choices = tower.GetChoiceCount();
+    if (choices == 0) return;
+
+    if (event.key == SDLK_LEFT) {
+        selected = (selected + choices - 1) % choices;
+        RefreshNodes();
+    } else if (event.key == SDLK_RIGHT) {
+        selected = (selected + 1) % choices;
+        RefreshNodes();
+    } else if (event.key == SDLK_RETURN) {
+        EnterSelected();
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <vector>
+#include "../core/Scene.hpp"
+#include "../objects/MapNode.hpp"
+#include "../logic/RunState.hpp"
+
+// Mapa da torre da subida em andamento (SceneManager::GetRun): setas escolhem a proxima sala entre as ligadas a atual; ENTER entra nela
+class SceneMap : public Scene {
+    private:
+        TowerManager& tower;
+        std::vector<MapNode*> nodes;    // indexado pela sala
+        int selected;                   // indice em GetChoice
+        bool inBattle;
+
+        InputManager* input;
+        Mylib::Event::Handler<KeyEvent>::Descriptor keyDescriptor;
+
+        void RefreshNodes();
+        void EnterSelected();
+    public:
+        SceneMap(SceneManager& scenes);
+        virtual ~SceneMap();
+
+        virtual void Build() override;
+        virtual void Enter(InputManager& input) override;
+        virtual void Exit() override;
+
+        void OnKey(KeyEvent& event);
+        const TowerManager& GetTower() const { return tower; }
+};
@@ -0,0 +1,208 @@
+// Compila definicoes de cartas em texto para o formato binario lido pelo jogo.
+// Uma carta por linha:  id | nome | tipo | custo | ataque | vida | efeitos
+// Efeitos separados por virgula: "DAMAGE 6", "HEAL 5, DRAW 1", "SUMMON 2 Lobo"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include "logic/CardData.hpp"
+#include "logic/BaseCards.hpp"
+
+static const char* TypeNames[] = { "CREATURE", "SPELL" };
+static const char* EffectNames[] = { "NONE", "DAMAGE", "HEAL", "ARMOR", "DRAW", "SUMMON" };
+
+struct ParsedCard {
+    CardDefinition definition;
+    std::string name;
+    std::string summonTargets[MaxCardEffects];  // resolvidos depois de ler o arquivo todo
+    int line;
+};
+
+static std::string Trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+static std::vector<std::string> Split(const std::string& text, char separator) {
+    std::vector<std::string> parts;
+    std::stringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, separator)) {
+        parts.push_back(Trim(part));
+    }
+    if (!text.empty() && text.back() == separator) parts.push_back("");
+    return parts;
+}
+
+template <size_t N>
+static int IndexOf(const char* (&names)[N], const std::string& name) {
+    for (size_t i = 0; i < N; i++) {
+        if (name == names[i]) return (int)i;
+    }
+    return -1;
+}
+
+static bool ParseEffect(const std::string& text, ParsedCard& card, size_t slot) {
+    std::stringstream stream(text);
+    std::string type;
+    int amount = 0;
+    stream >> type >> amount;
+
+    int index = IndexOf(EffectNames, type);
+    if (index <= 0 || amount <= 0) return false;
+
+    card.definition.effects[slot].type = (EffectType)index;
+    card.definition.effects[slot].amount = (int16_t)amount;
+
+    if (card.definition.effects[slot].type == EffectType::SUMMON) {
+        std::string target;
+        std::getline(stream, target);
+        card.summonTargets[slot] = Trim(target);
+        if (card.summonTargets[slot].empty()) return false;
+    }
+    return true;
+}
+
+static bool ParseLine(const std::string& line, ParsedCard& card) {
+    std::vector<std::string> fields = Split(line, '|');
+    if (fields.size() != 7) return false;
+
+    int id = std::atoi(fields[0].c_str());
+    int type = IndexOf(TypeNames, fields[2]);
+    int cost = std::atoi(fields[3].c_str());
+    if (id < 0 || id >= InvalidCard || fields[1].empty() || type < 0 || cost < 0 || cost > MaxManaCost) return false;
+
+    card.name = fields[1];
+    card.definition.id = (CardId)id;
+    card.definition.type = (CardType)type;
+    card.definition.manaCost = (uint8_t)cost;
+    card.definition.attack = (int16_t)std::atoi(fields[4].c_str());
+    card.definition.health = (int16_t)std::atoi(fields[5].c_str());
+
+    if (fields[6].empty()) return true;
+
+    std::vector<std::string> effects = Split(fields[6], ',');
+    if (effects.size() > MaxCardEffects) return false;
+    for (size_t i = 0; i < effects.size(); i++) {
+        if (!ParseEffect(effects[i], card, i)) return false;
+    }
+    return true;
+}
+
+static int Compile(const char* input, const char* output) {
+    std::ifstream in(input);
+    if (!in) {
+        std::cerr << "Erro ao abrir " << input << std::endl;
+        return 1;
+    }
+
+    std::vector<ParsedCard> cards;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        line = Trim(line);
+        if (line.empty() || line[0] == '#') continue;
+
+        ParsedCard card;
+        card.line = lineNumber;
+        if (!ParseLine(line, card)) {
+            std::cerr << input << ":" << lineNumber << ": linha invalida" << std::endl;
+            return 1;
+        }
+        cards.push_back(std::move(card));
+    }
+
+    CardDataWriter writer;
+    for (ParsedCard& card : cards) {
+        for (size_t e = 0; e < MaxCardEffects; e++) {
+            const std::string& target = card.summonTargets[e];
+            if (target.empty()) continue;
+
+            // Primeiro no proprio arquivo (pode renomear cartas base), depois no conjunto base
+            CardId id = InvalidCard;
+            for (const ParsedCard& other : cards) {
+                if (other.name == target) id = other.definition.id;
+            }
+            if (id == InvalidCard) id = BaseCardIndex.Find(target, BaseCards);
+            if (id == InvalidCard) {
+                std::cerr << input << ":" << card.line << ": carta desconhecida: " << target << std::endl;
+                return 1;
+            }
+            card.definition.effects[e].card = id;
+        }
+
+        card.definition.name = card.name;
+        if (!writer.Add(card.definition)) {
+            std::cerr << input << ":" << card.line << ": carta rejeitada" << std::endl;
+            return 1;
+        }
+    }
+
+    // Aplica num banco com o conjunto base, como o jogo fara, antes de gravar: o jogo observa
+    // o arquivo de saida e recarregaria um arquivo recusado
+    std::vector<uint8_t> bytes;
+    writer.Serialize(bytes);
+
+    CardDataFile file;
+    CardDatabase database;
+    database.AddBaseSet();
+    if (!file.Open(bytes.data(), bytes.size())) {
+        return 1;
+    }
+    int changed = file.ApplyTo(database);
+    file.Close();
+    if (changed < 0) {
+        return 1;
+    }
+
+    if (!WriteFileAtomic(output, bytes)) {
+        return 1;
+    }
+
+    std::cout << output << ": " << writer.Size() << " cartas, " << changed << " diferentes do conjunto base" << std::endl;
+    return 0;
+}
+
+static int ExportBase(const char* output) {
+    std::ofstream out(output);
+    if (!out) {
+        std::cerr << "Erro ao criar " << output << std::endl;
+        return 1;
+    }
+
+    out << "# id | nome | tipo | custo | ataque | vida | efeitos\n";
+    for (const CardDefinition& card : BaseCards) {
+        out << card.id << " | " << card.name << " | " << TypeNames[(int)card.type] << " | " << (int)card.manaCost
+            << " | " << card.attack << " | " << card.health << " |";
+
+        for (size_t e = 0; e < MaxCardEffects; e++) {
+            const CardEffect& effect = card.effects[e];
+            if (effect.type == EffectType::NONE) break;
+
+            out << (e > 0 ? ", " : " ") << EffectNames[(int)effect.type] << " " << effect.amount;
+            if (effect.type == EffectType::SUMMON) out << " " << BaseCards[effect.card].name;
+        }
+        out << "\n";
+    }
+
+    std::cout << output << ": " << BaseCards.size() << " cartas base" << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 3 && std::strcmp(argv[1], "--export-base") == 0) {
+        return ExportBase(argv[2]);
+    }
+    if (argc == 3) {
+        return Compile(argv[1], argv[2]);
+    }
+
+    std::cerr << "Uso: " << argv[0] << " <cartas.txt> <cartas.bin>" << std::endl;
+    std::cerr << "     " << argv[0] << " --export-base <cartas.txt>" << std::endl;
+    return 1;
+}
@@ -0,0 +1,61 @@
+// Empacota um diretorio de assets em um unico .pak lido pelo jogo com mmap.
+// Uso: pack_assets [--compress] [--align N] <diretorio> <saida.pak>
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include "core/PackArchive.hpp"
+
+int main(int argc, char* argv[]) {
+    bool compress = false;
+    uint32_t alignment = 16;
+    const char* directory = nullptr;
+    const char* output = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--compress") == 0) {
+            compress = true;
+        } else if (std::strcmp(argv[i], "--align") == 0 && i + 1 < argc) {
+            alignment = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+        } else if (!directory) {
+            directory = argv[i];
+        } else if (!output) {
+            output = argv[i];
+        }
+    }
+
+    if (!directory || !output) {
+        std::cerr << "Uso: " << argv[0] << " [--compress] [--align N] <diretorio> <saida.pak>" << std::endl;
+        return 1;
+    }
+
+    PackWriter writer(alignment);
+    int files = writer.AddDirectory(directory, compress);
+    if (files == 0) {
+        std::cerr << "Nenhum arquivo encontrado em " << directory << std::endl;
+        return 1;
+    }
+
+    if (!writer.Write(output)) {
+        return 1;
+    }
+
+    PackArchive archive;
+    if (!archive.Open(output)) {
+        std::cerr << "Falha ao reabrir " << output << std::endl;
+        return 1;
+    }
+
+    uint64_t stored = 0;
+    uint64_t original = 0;
+    uint32_t compressed = 0;
+    for (uint32_t i = 0; i < archive.GetEntryCount(); i++) {
+        const PackEntry& entry = archive.GetEntry(i);
+        stored += entry.storedSize;
+        original += entry.size;
+        if (entry.flags & PACK_ENTRY_LZ4) compressed++;
+    }
+
+    std::cout << output << ": " << files << " arquivos (" << compressed << " comprimidos), "
+              << original << " -> " << stored << " bytes" << std::endl;
+    return 0;
+}